@@ -77,24 +77,62 @@ Z_INTERNAL uint32_t adler32_c(uint32_t adler, const unsigned char *buf, size_t l
     return adler | (sum2 << 16);
 }
 
+/* =========================================================================
+ * Four-lane Adler-32 for the multi-buffer API. Each lane is an independent
+ * buffer; interleaving them gives the otherwise serial sum chains of the
+ * scalar loop something to overlap with. len must be a multiple of 16 and no
+ * larger than any of the four buffers.
+ */
+Z_INTERNAL void adler32_x4_c(uint32_t sum[4], const unsigned char *buf[4], size_t len) {
+    uint32_t a0, a1, a2, a3, b0, b1, b2, b3;
+    const unsigned char *p0 = buf[0], *p1 = buf[1], *p2 = buf[2], *p3 = buf[3];
+    size_t i, n;
+
+    a0 = sum[0] & 0xffff; b0 = sum[0] >> 16;
+    a1 = sum[1] & 0xffff; b1 = sum[1] >> 16;
+    a2 = sum[2] & 0xffff; b2 = sum[2] >> 16;
+    a3 = sum[3] & 0xffff; b3 = sum[3] >> 16;
+
+    while (len) {
+        n = MIN(len, NMAX);
+        len -= n;
+        for (i = 0; i < n; i++) {
+            DO1(a0, b0, p0, i);
+            DO1(a1, b1, p1, i);
+            DO1(a2, b2, p2, i);
+            DO1(a3, b3, p3, i);
+        }
+        p0 += n; p1 += n; p2 += n; p3 += n;
+        a0 %= BASE; b0 %= BASE;
+        a1 %= BASE; b1 %= BASE;
+        a2 %= BASE; b2 %= BASE;
+        a3 %= BASE; b3 %= BASE;
+    }
+
+    sum[0] = a0 | (b0 << 16);
+    sum[1] = a1 | (b1 << 16);
+    sum[2] = a2 | (b2 << 16);
+    sum[3] = a3 | (b3 << 16);
+}
+
 #ifdef ZLIB_COMPAT
 unsigned long Z_EXPORT PREFIX(adler32_z)(unsigned long adler, const unsigned char *buf, size_t len) {
-    return (unsigned long)functable.adler32((uint32_t)adler, buf, len);
+    return (unsigned long)FUNCTABLE_ADLER32((uint32_t)adler, buf, len);
 }
 #else
 uint32_t Z_EXPORT PREFIX(adler32_z)(uint32_t adler, const unsigned char *buf, size_t len) {
-    return functable.adler32(adler, buf, len);
+    return FUNCTABLE_ADLER32(adler, buf, len);
 }
 #endif
 
 /* ========================================================================= */
 #ifdef ZLIB_COMPAT
 unsigned long Z_EXPORT PREFIX(adler32)(unsigned long adler, const unsigned char *buf, unsigned int len) {
-    return (unsigned long)functable.adler32((uint32_t)adler, buf, len);
+    return (unsigned long)FUNCTABLE_ADLER32((uint32_t)adler, buf, len);
 }
 #else
 uint32_t Z_EXPORT PREFIX(adler32)(uint32_t adler, const unsigned char *buf, uint32_t len) {
-    return functable.adler32(adler, buf, len);
+    return FUNCTABLE_ADLER32(adler, buf, len);
 }
 #endif
 
@@ -107,4 +107,49 @@ uint32_t crc32_acle(uint32_t crc, const unsigned char *buf, uint64_t len) {
     c = ~c;
     return c;
 }
+
+/* Four buffers at a time for the multi-buffer API, interleaved so that the
+ * latency of each CRC instruction is hidden behind those of the other lanes.
+ * len must be a multiple of 16 and no larger than any of the four buffers. */
+void crc32_x4_acle(uint32_t sum[4], const unsigned char *buf[4], size_t len) {
+    Z_REGISTER uint32_t c0, c1, c2, c3;
+    const unsigned char *p0 = buf[0], *p1 = buf[1], *p2 = buf[2], *p3 = buf[3];
+    size_t i;
+
+    c0 = ~sum[0];
+    c1 = ~sum[1];
+    c2 = ~sum[2];
+    c3 = ~sum[3];
+
+#if defined(__aarch64__)
+    uint64_t w0, w1, w2, w3;
+    for (i = 0; i < len; i += sizeof(uint64_t)) {
+        memcpy(&w0, p0 + i, sizeof(w0));
+        memcpy(&w1, p1 + i, sizeof(w1));
+        memcpy(&w2, p2 + i, sizeof(w2));
+        memcpy(&w3, p3 + i, sizeof(w3));
+        c0 = __crc32d(c0, w0);
+        c1 = __crc32d(c1, w1);
+        c2 = __crc32d(c2, w2);
+        c3 = __crc32d(c3, w3);
+    }
+#else
+    uint32_t w0, w1, w2, w3;
+    for (i = 0; i < len; i += sizeof(uint32_t)) {
+        memcpy(&w0, p0 + i, sizeof(w0));
+        memcpy(&w1, p1 + i, sizeof(w1));
+        memcpy(&w2, p2 + i, sizeof(w2));
+        memcpy(&w3, p3 + i, sizeof(w3));
+        c0 = __crc32w(c0, w0);
+        c1 = __crc32w(c1, w1);
+        c2 = __crc32w(c2, w2);
+        c3 = __crc32w(c3, w3);
+    }
+#endif
+
+    sum[0] = ~c0;
+    sum[1] = ~c1;
+    sum[2] = ~c2;
+    sum[3] = ~c3;
+}
 #endif
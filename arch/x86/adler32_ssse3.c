@@ -107,4 +107,59 @@ Z_INTERNAL uint32_t adler32_ssse3(uint32_t adler, const unsigned char *buf, size
     return adler32_len_16(adler, buf, len, sum2);
 }
 
+/* Four buffers at a time for the multi-buffer API. Every lane keeps its own
+ * pair of vector accumulators, so the four dependency chains are independent
+ * and only need one horizontal reduction each per NMAX bytes. len must be a
+ * multiple of 16 and no larger than any of the four buffers. */
+#define ADLER_X4_INIT(k) \
+    vs1_##k = _mm_cvtsi32_si128((int)(sum[k] & 0xffff)); \
+    vs2_##k = _mm_cvtsi32_si128((int)(sum[k] >> 16))
+
+#define ADLER_X4_STEP(k) { \
+    __m128i vbuf = _mm_loadu_si128((__m128i *)(buf[k] + i)); \
+    vs2_##k = _mm_add_epi32(vs2_##k, _mm_slli_epi32(vs1_##k, 4)); \
+    vs1_##k = _mm_add_epi32(vs1_##k, _mm_madd_epi16(_mm_maddubs_epi16(vbuf, dot1v), dot3v)); \
+    vs2_##k = _mm_add_epi32(vs2_##k, _mm_madd_epi16(_mm_maddubs_epi16(vbuf, dot2v), dot3v)); \
+}
+
+/* The horizontal sums of each lane's accumulators are exactly the unreduced
+ * scalar sums, which NMAX guarantees to fit in 32 bits, so all four lanes can
+ * be summed together with hadd and then reduced once each. */
+static inline void adler32_x4_reduce(uint32_t sum[4], __m128i v0, __m128i v1, __m128i v2, __m128i v3, int shift) {
+    uint32_t ALIGNED_(16) s[4];
+    int k;
+
+    _mm_store_si128((__m128i *)s, _mm_hadd_epi32(_mm_hadd_epi32(v0, v1), _mm_hadd_epi32(v2, v3)));
+    for (k = 0; k < 4; k++)
+        sum[k] |= (s[k] % BASE) << shift;
+}
+
+Z_INTERNAL void adler32_x4_ssse3(uint32_t sum[4], const unsigned char *buf[4], size_t len) {
+    const __m128i dot1v = _mm_set1_epi8(1);
+    const __m128i dot2v = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m128i dot3v = _mm_set1_epi16(1);
+    __m128i vs1_0, vs1_1, vs1_2, vs1_3;
+    __m128i vs2_0, vs2_1, vs2_2, vs2_3;
+    size_t i = 0, n;
+
+    while (i < len) {
+        ADLER_X4_INIT(0);
+        ADLER_X4_INIT(1);
+        ADLER_X4_INIT(2);
+        ADLER_X4_INIT(3);
+
+        /* NMAX is divisible by 16 */
+        for (n = i + MIN(len - i, NMAX); i < n; i += 16) {
+            ADLER_X4_STEP(0);
+            ADLER_X4_STEP(1);
+            ADLER_X4_STEP(2);
+            ADLER_X4_STEP(3);
+        }
+
+        sum[0] = sum[1] = sum[2] = sum[3] = 0;
+        adler32_x4_reduce(sum, vs1_0, vs1_1, vs1_2, vs1_3, 0);
+        adler32_x4_reduce(sum, vs2_0, vs2_1, vs2_2, vs2_3, 16);
+    }
+}
+
 #endif
@@ -226,7 +226,9 @@ static void partial_fold(const size_t len, __m128i *xmm_crc0, __m128i *xmm_crc1,
     *xmm_crc3 = _mm_castps_si128(ps_res);
 }
 
-Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *dst, const unsigned char *src, long len) {
+/* Fold len bytes of src into crc0, and copy them to dst if copy is set */
+static inline void crc_fold_tpl(unsigned int crc0[4 * 5], unsigned char *dst, const unsigned char *src, long len,
+                                const int copy) {
     unsigned long algn_diff;
     __m128i xmm_t0, xmm_t1, xmm_t2, xmm_t3;
     char ALIGNED_(16) partial_buf[16] = { 0 };
@@ -244,14 +246,16 @@ Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *dst, cons
 
         memcpy(partial_buf, src, len);
         xmm_crc_part = _mm_loadu_si128((const __m128i *)partial_buf);
-        memcpy(dst, partial_buf, len);
+        if (copy)
+            memcpy(dst, partial_buf, len);
         goto partial;
     }
 
     algn_diff = ((uintptr_t)16 - ((uintptr_t)src & 0xF)) & 0xF;
     if (algn_diff) {
         xmm_crc_part = _mm_loadu_si128((__m128i *)src);
-        _mm_storeu_si128((__m128i *)dst, xmm_crc_part);
+        if (copy)
+            _mm_storeu_si128((__m128i *)dst, xmm_crc_part);
 
         dst += algn_diff;
         src += algn_diff;
@@ -272,10 +276,12 @@ Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *dst, cons
         fold_4(&xmm_crc0, &xmm_crc1, &xmm_crc2, &xmm_crc3);
 
         /* CRC_SAVE */
-        _mm_storeu_si128((__m128i *)dst, xmm_t0);
-        _mm_storeu_si128((__m128i *)dst + 1, xmm_t1);
-        _mm_storeu_si128((__m128i *)dst + 2, xmm_t2);
-        _mm_storeu_si128((__m128i *)dst + 3, xmm_t3);
+        if (copy) {
+            _mm_storeu_si128((__m128i *)dst, xmm_t0);
+            _mm_storeu_si128((__m128i *)dst + 1, xmm_t1);
+            _mm_storeu_si128((__m128i *)dst + 2, xmm_t2);
+            _mm_storeu_si128((__m128i *)dst + 3, xmm_t3);
+        }
 
         xmm_crc0 = _mm_xor_si128(xmm_crc0, xmm_t0);
         xmm_crc1 = _mm_xor_si128(xmm_crc1, xmm_t1);
@@ -298,9 +304,11 @@ Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *dst, cons
 
         fold_3(&xmm_crc0, &xmm_crc1, &xmm_crc2, &xmm_crc3);
 
-        _mm_storeu_si128((__m128i *)dst, xmm_t0);
-        _mm_storeu_si128((__m128i *)dst + 1, xmm_t1);
-        _mm_storeu_si128((__m128i *)dst + 2, xmm_t2);
+        if (copy) {
+            _mm_storeu_si128((__m128i *)dst, xmm_t0);
+            _mm_storeu_si128((__m128i *)dst + 1, xmm_t1);
+            _mm_storeu_si128((__m128i *)dst + 2, xmm_t2);
+        }
 
         xmm_crc1 = _mm_xor_si128(xmm_crc1, xmm_t0);
         xmm_crc2 = _mm_xor_si128(xmm_crc2, xmm_t1);
@@ -319,8 +327,10 @@ Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *dst, cons
 
         fold_2(&xmm_crc0, &xmm_crc1, &xmm_crc2, &xmm_crc3);
 
-        _mm_storeu_si128((__m128i *)dst, xmm_t0);
-        _mm_storeu_si128((__m128i *)dst + 1, xmm_t1);
+        if (copy) {
+            _mm_storeu_si128((__m128i *)dst, xmm_t0);
+            _mm_storeu_si128((__m128i *)dst + 1, xmm_t1);
+        }
 
         xmm_crc2 = _mm_xor_si128(xmm_crc2, xmm_t0);
         xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_t1);
@@ -337,7 +347,8 @@ Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *dst, cons
 
         fold_1(&xmm_crc0, &xmm_crc1, &xmm_crc2, &xmm_crc3);
 
-        _mm_storeu_si128((__m128i *)dst, xmm_t0);
+        if (copy)
+            _mm_storeu_si128((__m128i *)dst, xmm_t0);
 
         xmm_crc3 = _mm_xor_si128(xmm_crc3, xmm_t0);
 
@@ -353,8 +364,10 @@ Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *dst, cons
         memcpy(&xmm_crc_part, src, len);
     }
 
-    _mm_storeu_si128((__m128i *)partial_buf, xmm_crc_part);
-    memcpy(dst, partial_buf, len);
+    if (copy) {
+        _mm_storeu_si128((__m128i *)partial_buf, xmm_crc_part);
+        memcpy(dst, partial_buf, len);
+    }
 
 partial:
     partial_fold((size_t)len, &xmm_crc0, &xmm_crc1, &xmm_crc2, &xmm_crc3, &xmm_crc_part);
@@ -367,6 +380,15 @@ done:
     _mm_storeu_si128((__m128i *)crc0 + 4, xmm_crc_part);
 }
 
+Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *dst, const unsigned char *src, long len) {
+    crc_fold_tpl(crc0, dst, src, len, 1);
+}
+
+Z_INTERNAL void crc_fold(unsigned int crc0[4 * 5], const unsigned char *src, long len) {
+    /* dst follows src along, and is never written */
+    crc_fold_tpl(crc0, (unsigned char *)src, src, len, 0);
+}
+
 static const unsigned ALIGNED_(16) crc_k[] = {
     0xccaa009e, 0x00000000, /* rk1 */
     0x751997d0, 0x00000001, /* rk2 */
@@ -453,4 +475,38 @@ uint32_t Z_INTERNAL crc_fold_512to32(unsigned int crc0[4 * 5]) {
     return ~crc;
 }
 
+/* Four-lane CRC-32 for the multi-buffer API. The folding loop already keeps four
+ * carry-less multiplies in flight for one buffer, so the lanes are folded one
+ * after the other. A lane starts from a zero state, with the register of its
+ * CRC so far XORed into its first four bytes. len must be a multiple of 16.
+ * Below CRC_X4_FOLD_MIN bytes, setting up and reducing the folds costs more
+ * than the table lookups of crc32_x4_c() interleaved across the lanes. */
+#define CRC_X4_FOLD_MIN 128
+
+extern void crc32_x4_c(uint32_t sum[4], const unsigned char *buf[4], size_t len);
+
+Z_INTERNAL void crc32_x4_pclmulqdq(uint32_t sum[4], const unsigned char *buf[4], size_t len) {
+    unsigned ALIGNED_(16) crc0[4 * 5];
+    unsigned char ALIGNED_(16) first[16];
+    uint32_t c;
+    int k;
+
+    if (len < CRC_X4_FOLD_MIN) {
+        crc32_x4_c(sum, buf, len);
+        return;
+    }
+    for (k = 0; k < 4; k++) {
+        memset(crc0, 0, sizeof(crc0));
+        memcpy(first, buf[k], sizeof(first));
+        c = ~sum[k];
+        first[0] ^= (unsigned char)c;
+        first[1] ^= (unsigned char)(c >> 8);
+        first[2] ^= (unsigned char)(c >> 16);
+        first[3] ^= (unsigned char)(c >> 24);
+        crc_fold(crc0, first, sizeof(first));
+        crc_fold(crc0, buf[k] + sizeof(first), (long)(len - sizeof(first)));
+        sum[k] = crc_fold_512to32(crc0);
+    }
+}
+
 #endif
@@ -15,5 +15,6 @@
 Z_INTERNAL uint32_t crc_fold_init(unsigned int crc0[4 * 5]);
 Z_INTERNAL uint32_t crc_fold_512to32(unsigned int crc0[4 * 5]);
 Z_INTERNAL void crc_fold_copy(unsigned int crc0[4 * 5], unsigned char *, const unsigned char *, long);
+Z_INTERNAL void crc_fold(unsigned int crc0[4 * 5], const unsigned char *, long);
 
 #endif
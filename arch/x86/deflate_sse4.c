@@ -0,0 +1,45 @@
+/* deflate_sse4.c -- deflate strategies built for SSE4.2 with the leaf functions bound statically
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * The CRC hash is inlined into the strategy loops and longest_match and compare258 are called
+ * directly instead of through the function table.
+ */
+
+#include "../../zbuild.h"
+#include "../../deflate.h"
+#include "../../deflate_p.h"
+
+#ifdef X86_SSE42_DEFLATE
+
+#include "insert_string_sse.h"
+
+extern uint32_t longest_match_unaligned_sse4(deflate_state *const s, Pos cur_match);
+extern uint32_t longest_match_slow_unaligned_sse4(deflate_state *const s, Pos cur_match);
+extern uint32_t compare258_unaligned_sse4(const unsigned char *src0, const unsigned char *src1);
+
+#define HASH_CALC_VAR          h
+#define HASH_CALC_VAR_INIT     uint32_t h = 0
+
+#define INSERT_STRING_LINKAGE  static inline
+#define UPDATE_HASH            update_hash_inline
+#define INSERT_STRING          insert_string_inline
+#define QUICK_INSERT_STRING    quick_insert_string_inline
+
+#include "../../insert_string_tpl.h"
+
+#define LONGEST_MATCH          longest_match_unaligned_sse4
+#define LONGEST_MATCH_SLOW     longest_match_slow_unaligned_sse4
+#define COMPARE258             compare258_unaligned_sse4
+
+#define DEFLATE_FAST           deflate_fast_sse4
+#include "../../deflate_fast_tpl.h"
+
+#ifndef NO_MEDIUM_STRATEGY
+#  define DEFLATE_MEDIUM       deflate_medium_sse4
+#  include "../../deflate_medium_tpl.h"
+#endif
+
+#define DEFLATE_SLOW           deflate_slow_sse4
+#include "../../deflate_slow_tpl.h"
+
+#endif
@@ -0,0 +1,43 @@
+/* insert_string_sse.h -- SSE4.2 CRC hash shared by the insert_string variants
+ *                        and the deflate strategies built for SSE4.2 and up
+ *
+ * Copyright (C) 1995-2013 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ */
+
+#ifndef INSERT_STRING_SSE_H_
+#define INSERT_STRING_SSE_H_
+
+#include <immintrin.h>
+#ifdef _MSC_VER
+#  include <nmmintrin.h>
+#endif
+
+#ifdef X86_SSE42_CRC_INTRIN
+#  ifdef _MSC_VER
+#    define HASH_CALC(s, h, val)\
+        h = _mm_crc32_u32(h, val)
+#  else
+#    define HASH_CALC(s, h, val)\
+        h = __builtin_ia32_crc32si(h, val)
+#  endif
+#else
+#  ifdef _MSC_VER
+#    define HASH_CALC(s, h, val) {\
+        __asm mov edx, h\
+        __asm mov eax, val\
+        __asm crc32 eax, edx\
+        __asm mov val, eax\
+    }
+#  else
+#    define HASH_CALC(s, h, val) \
+        __asm__ __volatile__ (\
+            "crc32 %1,%0\n\t"\
+            : "+r" (h)\
+            : "r" (val)\
+        );
+#  endif
+#endif
+
+#endif
@@ -15,4 +15,12 @@ extern int x86_cpu_has_tzcnt;
 
 void Z_INTERNAL x86_check_features(void);
 
+/* Deflate strategies built per instruction set tier, see deflate_sse4.c and deflate_avx2.c */
+#if defined(X86_SSE42_CRC_HASH) && defined(X86_SSE42_CMP_STR) && defined(UNALIGNED_OK)
+#  define X86_SSE42_DEFLATE
+#endif
+#if defined(X86_SSE42_CRC_HASH) && defined(X86_AVX2) && defined(HAVE_BUILTIN_CTZ) && defined(UNALIGNED_OK)
+#  define X86_AVX2_DEFLATE
+#endif
+
 #endif /* CPU_H_ */
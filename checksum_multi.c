@@ -0,0 +1,94 @@
+/* checksum_multi.c -- compute the checksums of many independent buffers
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Short buffers are dominated by call overhead and by the setup and tail
+ * handling of the single-buffer kernels. Here four buffers are kept in flight
+ * at once, one per lane of a four-lane kernel. The lanes are advanced together
+ * by the length of the shortest of them, and as soon as one of them runs out,
+ * its tail is finished by the single-buffer kernel and the lane is refilled
+ * with the next buffer in the array.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "functable.h"
+
+#ifndef ZLIB_COMPAT
+
+#define MULTI_LANES     4
+#define MULTI_GRAIN     16      /* the four-lane kernels advance in multiples of this */
+
+typedef void (*multi_func) (uint32_t sum[4], const unsigned char *buf[4], size_t len);
+typedef uint32_t (*single_func) (uint32_t sum, const unsigned char *buf, size_t len);
+
+static uint32_t crc32_single(uint32_t crc, const unsigned char *buf, size_t len) {
+    return functable.crc32(crc, buf, len);
+}
+
+static uint32_t adler32_single(uint32_t adler, const unsigned char *buf, size_t len) {
+    return functable.adler32(adler, buf, len);
+}
+
+static void checksum_multi(zng_checksum_buf *bufs, size_t count, uint32_t init,
+                           multi_func multi, single_func single) {
+    zng_checksum_buf *lane[MULTI_LANES];
+    const unsigned char *buf[MULTI_LANES];
+    uint32_t sum[MULTI_LANES];
+    size_t left[MULTI_LANES];
+    size_t next = 0, len;
+    int active = 0, k;
+
+    for (;;) {
+        /* Fill the empty lanes, finishing short buffers right away */
+        while (active < MULTI_LANES && next < count) {
+            zng_checksum_buf *job = &bufs[next++];
+            if (job->buf == NULL) {
+                job->result = init;
+            } else if (job->len < MULTI_GRAIN) {
+                job->result = single(job->seed, job->buf, job->len);
+            } else {
+                lane[active] = job;
+                buf[active] = job->buf;
+                sum[active] = job->seed;
+                left[active] = job->len;
+                active++;
+            }
+        }
+        if (active < MULTI_LANES)
+            break;
+
+        len = MIN(MIN(left[0], left[1]), MIN(left[2], left[3]));
+        len -= len % MULTI_GRAIN;
+        multi(sum, buf, len);
+
+        /* Retire the lanes that cannot be advanced any further */
+        for (k = MULTI_LANES - 1; k >= 0; k--) {
+            buf[k] += len;
+            left[k] -= len;
+            if (left[k] < MULTI_GRAIN) {
+                lane[k]->result = single(sum[k], buf[k], left[k]);
+                active--;
+                lane[k] = lane[active];
+                buf[k] = buf[active];
+                sum[k] = sum[active];
+                left[k] = left[active];
+            }
+        }
+    }
+
+    /* Too few buffers remain to fill all lanes */
+    for (k = 0; k < active; k++)
+        lane[k]->result = single(sum[k], buf[k], left[k]);
+}
+
+/* ========================================================================= */
+void Z_EXPORT zng_crc32_multi(zng_checksum_buf *bufs, size_t count) {
+    checksum_multi(bufs, count, 0, functable.crc32_x4, crc32_single);
+}
+
+/* ========================================================================= */
+void Z_EXPORT zng_adler32_multi(zng_checksum_buf *bufs, size_t count) {
+    checksum_multi(bufs, count, 1, functable.adler32_x4, adler32_single);
+}
+
+#endif /* ZLIB_COMPAT */
@@ -0,0 +1,107 @@
+/* checksum_parallel.c -- compute CRC-32 and Adler-32 checksums concurrently
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * The buffer is split into equally sized slices whose checksums are computed
+ * independently on the threads of a caller-supplied executor, and then
+ * stitched together with the checksum combine operators. All slices but the
+ * last have the same length, so the CRC-32 combine operator only needs to be
+ * generated twice regardless of the number of slices.
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "functable.h"
+
+#ifndef ZLIB_COMPAT
+
+#define PARALLEL_MAX_TASKS        64
+#define PARALLEL_MIN_TASK_SIZE    (256 * 1024)
+
+typedef struct parallel_job_s {
+    const uint8_t *buf;
+    size_t len;
+    size_t slice_len;
+    int crc;
+    uint32_t sums[PARALLEL_MAX_TASKS];
+} parallel_job;
+
+static void checksum_slice(void *task_arg, size_t index) {
+    parallel_job *job = (parallel_job *)task_arg;
+    size_t start = index * job->slice_len;
+    size_t len = MIN(job->slice_len, job->len - start);
+
+    if (job->crc)
+        job->sums[index] = functable.crc32(0, job->buf + start, len);
+    else
+        job->sums[index] = functable.adler32(1, job->buf + start, len);
+}
+
+/* Returns the number of slices to split len bytes into, or 1 to run serially */
+static size_t parallel_slices(size_t len, const zng_executor *executor, size_t *slice_len) {
+    size_t min_size, count;
+
+    if (executor == NULL || executor->run == NULL || executor->max_tasks <= 1)
+        return 1;
+
+    min_size = executor->min_task_size ? executor->min_task_size : PARALLEL_MIN_TASK_SIZE;
+    count = MIN(executor->max_tasks, PARALLEL_MAX_TASKS);
+    count = MIN(count, len / min_size);
+    if (count <= 1)
+        return 1;
+
+    *slice_len = (len + count - 1) / count;
+    /* Rounding up the slice length may leave the last slices empty */
+    return (len + *slice_len - 1) / *slice_len;
+}
+
+/* ========================================================================= */
+uint32_t Z_EXPORT zng_crc32_parallel(uint32_t crc, const uint8_t *buf, size_t len, const zng_executor *executor) {
+    parallel_job job;
+    uint32_t op[32];
+    size_t count, last, i;
+
+    if (buf == NULL)
+        return 0;
+
+    count = parallel_slices(len, executor, &job.slice_len);
+    if (count == 1)
+        return functable.crc32(crc, buf, len);
+
+    job.buf = buf;
+    job.len = len;
+    job.crc = 1;
+    if (executor->run(executor->opaque, checksum_slice, &job, count) != Z_OK)
+        return functable.crc32(crc, buf, len);
+
+    last = len - (count - 1) * job.slice_len;
+    zng_crc32_combine_gen(op, (z_off64_t)job.slice_len);
+    for (i = 0; i < count - 1; i++)
+        crc = zng_crc32_combine_op(crc, job.sums[i], op);
+    zng_crc32_combine_gen(op, (z_off64_t)last);
+    return zng_crc32_combine_op(crc, job.sums[count - 1], op);
+}
+
+/* ========================================================================= */
+uint32_t Z_EXPORT zng_adler32_parallel(uint32_t adler, const uint8_t *buf, size_t len, const zng_executor *executor) {
+    parallel_job job;
+    size_t count, i;
+
+    if (buf == NULL)
+        return 1;
+
+    count = parallel_slices(len, executor, &job.slice_len);
+    if (count == 1)
+        return functable.adler32(adler, buf, len);
+
+    job.buf = buf;
+    job.len = len;
+    job.crc = 0;
+    if (executor->run(executor->opaque, checksum_slice, &job, count) != Z_OK)
+        return functable.adler32(adler, buf, len);
+
+    for (i = 0; i < count - 1; i++)
+        adler = zng_adler32_combine(adler, job.sums[i], (z_off64_t)job.slice_len);
+    return zng_adler32_combine(adler, job.sums[count - 1], (z_off64_t)(len - (count - 1) * job.slice_len));
+}
+
+#endif /* ZLIB_COMPAT */
@@ -14,7 +14,9 @@
 #include <inttypes.h>
 #include "deflate.h"
 #include "functable.h"
+#include "crc32_p.h"
 #include "crc32_tbl.h"
+#include "crc32_braid_tbl.h"
 
 /* =========================================================================
  * This function can be used by asm versions of crc32()
@@ -27,13 +29,13 @@ const uint32_t * Z_EXPORT PREFIX(get_crc_table)(void) {
 unsigned long Z_EXPORT PREFIX(crc32_z)(unsigned long crc, const unsigned char *buf, size_t len) {
     if (buf == NULL) return 0;
 
-    return (unsigned long)functable.crc32((uint32_t)crc, buf, len);
+    return (unsigned long)FUNCTABLE_CRC32((uint32_t)crc, buf, len);
 }
 #else
 uint32_t Z_EXPORT PREFIX(crc32_z)(uint32_t crc, const unsigned char *buf, size_t len) {
     if (buf == NULL) return 0;
 
-    return functable.crc32(crc, buf, len);
+    return FUNCTABLE_CRC32(crc, buf, len);
 }
 #endif
 /* ========================================================================= */
@@ -85,48 +87,6 @@ uint32_t Z_EXPORT PREFIX(crc32)(uint32_t crc, const unsigned char *buf, uint32_t
    writes to the buffer that is passed to these routines.
  */
 
-/* ========================================================================= */
-#if BYTE_ORDER == LITTLE_ENDIAN
-#define DOLIT4 c ^= *buf4++; \
-        c = crc_table[3][c & 0xff] ^ crc_table[2][(c >> 8) & 0xff] ^ \
-            crc_table[1][(c >> 16) & 0xff] ^ crc_table[0][c >> 24]
-#define DOLIT32 DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4; DOLIT4
-
-/* ========================================================================= */
-Z_INTERNAL uint32_t crc32_little(uint32_t crc, const unsigned char *buf, uint64_t len) {
-    Z_REGISTER uint32_t c;
-    Z_REGISTER const uint32_t *buf4;
-
-    c = crc;
-    c = ~c;
-    while (len && ((ptrdiff_t)buf & 3)) {
-        c = crc_table[0][(c ^ *buf++) & 0xff] ^ (c >> 8);
-        len--;
-    }
-
-    buf4 = (const uint32_t *)(const void *)buf;
-
-#ifdef UNROLL_MORE
-    while (len >= 32) {
-        DOLIT32;
-        len -= 32;
-    }
-#endif
-
-    while (len >= 4) {
-        DOLIT4;
-        len -= 4;
-    }
-    buf = (const unsigned char *)buf4;
-
-    if (len) do {
-        c = crc_table[0][(c ^ *buf++) & 0xff] ^ (c >> 8);
-    } while (--len);
-    c = ~c;
-    return c;
-}
-#endif /* BYTE_ORDER == LITTLE_ENDIAN */
-
 /* ========================================================================= */
 #if BYTE_ORDER == BIG_ENDIAN
 #define DOBIG4 c ^= *buf4++; \
@@ -169,6 +129,183 @@ Z_INTERNAL uint32_t crc32_big(uint32_t crc, const unsigned char *buf, uint64_t l
 }
 #endif /* BYTE_ORDER == BIG_ENDIAN */
 
+/* =========================================================================
+ * Braided CRC-32. The input is split into BRAID_N interleaved lanes of
+ * BRAID_W-byte words, whose CRCs are computed independently so that the table
+ * lookups of each lane can overlap with the others. The lanes are carried
+ * forward a whole block at a time by crc_braid_table, and merged at the end by
+ * feeding them through the last block one word at a time.
+ */
+#if BRAID_W == 8
+#  define BRAID_LOOKUP(tbl, w) \
+        (tbl[0][(w) & 0xff] ^ tbl[1][((w) >> 8) & 0xff] ^ \
+         tbl[2][((w) >> 16) & 0xff] ^ tbl[3][((w) >> 24) & 0xff] ^ \
+         tbl[4][((w) >> 32) & 0xff] ^ tbl[5][((w) >> 40) & 0xff] ^ \
+         tbl[6][((w) >> 48) & 0xff] ^ tbl[7][(w) >> 56])
+#else
+#  define BRAID_LOOKUP(tbl, w) \
+        (tbl[0][(w) & 0xff] ^ tbl[1][((w) >> 8) & 0xff] ^ \
+         tbl[2][((w) >> 16) & 0xff] ^ tbl[3][(w) >> 24])
+#endif
+
+#if BYTE_ORDER == LITTLE_ENDIAN
+static inline uint32_t crc_word(z_word_t data) {
+    int k;
+    for (k = 0; k < BRAID_W; k++)
+        data = (data >> 8) ^ crc_table[0][data & 0xff];
+    return (uint32_t)data;
+}
+#else
+static inline z_word_t crc_word_big(z_word_t data) {
+    int k;
+    for (k = 0; k < BRAID_W; k++)
+        data = (data << 8) ^
+            ((z_word_t)crc_table[4][(data >> ((BRAID_W - 1) << 3)) & 0xff] << ((BRAID_W - 4) << 3));
+    return data;
+}
+
+#  if BRAID_W == 8
+#    define BRAID_SWAP(x) ZSWAP64(x)
+#  else
+#    define BRAID_SWAP(x) ZSWAP32(x)
+#  endif
+#endif
+
+Z_INTERNAL uint32_t crc32_braid(uint32_t crc, const unsigned char *buf, uint64_t len) {
+    Z_REGISTER uint32_t c;
+
+    c = ~crc;
+
+    /* Only braid when there is at least one full block after alignment */
+    if (len >= BRAID_N * BRAID_W + BRAID_W - 1) {
+        const z_word_t *words;
+        uint64_t blks;
+
+        /* Compute the CRC up to a word boundary */
+        while (len && ((ptrdiff_t)buf & (BRAID_W - 1)) != 0) {
+            c = crc_table[0][(c ^ *buf++) & 0xff] ^ (c >> 8);
+            len--;
+        }
+
+        blks = len / (BRAID_N * BRAID_W);
+        len -= blks * BRAID_N * BRAID_W;
+        words = (const z_word_t *)(const void *)buf;
+
+#if BYTE_ORDER == LITTLE_ENDIAN
+        uint32_t crc0, crc1, crc2, crc3, crc4;
+        z_word_t word0, word1, word2, word3, word4;
+
+        crc0 = c;
+        crc1 = crc2 = crc3 = crc4 = 0;
+
+        /* Process all but the last block, each braid independently */
+        while (--blks) {
+            word0 = crc0 ^ words[0];
+            word1 = crc1 ^ words[1];
+            word2 = crc2 ^ words[2];
+            word3 = crc3 ^ words[3];
+            word4 = crc4 ^ words[4];
+            words += BRAID_N;
+
+            crc0 = BRAID_LOOKUP(crc_braid_table, word0);
+            crc1 = BRAID_LOOKUP(crc_braid_table, word1);
+            crc2 = BRAID_LOOKUP(crc_braid_table, word2);
+            crc3 = BRAID_LOOKUP(crc_braid_table, word3);
+            crc4 = BRAID_LOOKUP(crc_braid_table, word4);
+        }
+
+        /* Process the last block, combining the braids */
+        c = crc_word(crc0 ^ words[0]);
+        c = crc_word(crc1 ^ words[1] ^ c);
+        c = crc_word(crc2 ^ words[2] ^ c);
+        c = crc_word(crc3 ^ words[3] ^ c);
+        c = crc_word(crc4 ^ words[4] ^ c);
+#else
+        z_word_t crc0, crc1, crc2, crc3, crc4;
+        z_word_t word0, word1, word2, word3, word4;
+        z_word_t comb;
+
+        crc0 = BRAID_SWAP((z_word_t)c);
+        crc1 = crc2 = crc3 = crc4 = 0;
+
+        /* Process all but the last block, each braid independently */
+        while (--blks) {
+            word0 = crc0 ^ words[0];
+            word1 = crc1 ^ words[1];
+            word2 = crc2 ^ words[2];
+            word3 = crc3 ^ words[3];
+            word4 = crc4 ^ words[4];
+            words += BRAID_N;
+
+            crc0 = BRAID_LOOKUP(crc_braid_big_table, word0);
+            crc1 = BRAID_LOOKUP(crc_braid_big_table, word1);
+            crc2 = BRAID_LOOKUP(crc_braid_big_table, word2);
+            crc3 = BRAID_LOOKUP(crc_braid_big_table, word3);
+            crc4 = BRAID_LOOKUP(crc_braid_big_table, word4);
+        }
+
+        /* Process the last block, combining the braids */
+        comb = crc_word_big(crc0 ^ words[0]);
+        comb = crc_word_big(crc1 ^ words[1] ^ comb);
+        comb = crc_word_big(crc2 ^ words[2] ^ comb);
+        comb = crc_word_big(crc3 ^ words[3] ^ comb);
+        comb = crc_word_big(crc4 ^ words[4] ^ comb);
+        c = (uint32_t)BRAID_SWAP(comb);
+#endif
+        words += BRAID_N;
+        buf = (const unsigned char *)words;
+    }
+
+    while (len) {
+        c = crc_table[0][(c ^ *buf++) & 0xff] ^ (c >> 8);
+        len--;
+    }
+    return ~c;
+}
+
+/* =========================================================================
+ * Four-lane CRC-32 for the multi-buffer API. Each lane is an independent
+ * buffer processed a word at a time with the slice-by-4 tables, interleaved so
+ * that the table lookups of one buffer overlap with those of the others.
+ * len must be a multiple of 16 and no larger than any of the four buffers.
+ */
+static inline uint32_t load_le32(const unsigned char *p) {
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+#if BYTE_ORDER == BIG_ENDIAN
+    w = ZSWAP32(w);
+#endif
+    return w;
+}
+
+#define CRC_X4_STEP(c, p) \
+        c ^= load_le32(p); \
+        c = crc_table[3][c & 0xff] ^ crc_table[2][(c >> 8) & 0xff] ^ \
+            crc_table[1][(c >> 16) & 0xff] ^ crc_table[0][c >> 24]
+
+Z_INTERNAL void crc32_x4_c(uint32_t sum[4], const unsigned char *buf[4], size_t len) {
+    Z_REGISTER uint32_t c0, c1, c2, c3;
+    const unsigned char *p0 = buf[0], *p1 = buf[1], *p2 = buf[2], *p3 = buf[3];
+    size_t i;
+
+    c0 = ~sum[0];
+    c1 = ~sum[1];
+    c2 = ~sum[2];
+    c3 = ~sum[3];
+
+    for (i = 0; i < len; i += 4) {
+        CRC_X4_STEP(c0, p0 + i);
+        CRC_X4_STEP(c1, p1 + i);
+        CRC_X4_STEP(c2, p2 + i);
+        CRC_X4_STEP(c3, p3 + i);
+    }
+
+    sum[0] = ~c0;
+    sum[1] = ~c1;
+    sum[2] = ~c2;
+    sum[3] = ~c3;
+}
+
 #ifdef X86_PCLMULQDQ_CRC
 #include "arch/x86/x86.h"
 #include "arch/x86/crc_folding.h"
@@ -181,7 +318,7 @@ Z_INTERNAL void crc_finalize(deflate_state *const s) {
 
 Z_INTERNAL void crc_reset(deflate_state *const s) {
 #ifdef X86_PCLMULQDQ_CRC
-    x86_check_features();
+    functable_init();
     if (x86_cpu_has_pclmulqdq) {
         s->strm->adler = crc_fold_init(s->crc0);
         return;
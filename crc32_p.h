@@ -6,6 +6,16 @@
 
 #define GF2_DIM 32      /* dimension of GF(2) vectors (length of CRC) */
 
+/* Braided CRC parameters: BRAID_N independent lanes of BRAID_W bytes each */
+#define BRAID_N 5
+#if defined(_WIN64) || (defined(__SIZEOF_POINTER__) && __SIZEOF_POINTER__ == 8)
+#  define BRAID_W 8
+typedef uint64_t z_word_t;
+#else
+#  define BRAID_W 4
+typedef uint32_t z_word_t;
+#endif
+
 
 static inline uint32_t gf2_matrix_times(const uint32_t *mat, uint32_t vec) {
     uint32_t sum = 0;
@@ -19,9 +29,8 @@ static inline uint32_t gf2_matrix_times(const uint32_t *mat, uint32_t vec) {
 }
 
 
-#if BYTE_ORDER == LITTLE_ENDIAN
-extern uint32_t crc32_little(uint32_t, const unsigned char *, uint64_t);
-#elif BYTE_ORDER == BIG_ENDIAN
+extern uint32_t crc32_braid(uint32_t, const unsigned char *, uint64_t);
+#if BYTE_ORDER == BIG_ENDIAN
 extern uint32_t crc32_big(uint32_t, const unsigned char *, uint64_t);
 #endif
 
@@ -110,8 +110,24 @@ Z_INTERNAL block_state deflate_medium(deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_slow  (deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_rle   (deflate_state *s, int flush);
 Z_INTERNAL block_state deflate_huff  (deflate_state *s, int flush);
+Z_INTERNAL block_state deflate_adaptive(deflate_state *s, int flush);
+#ifndef ZLIB_COMPAT
+Z_INTERNAL block_state deflate_sequences(deflate_state *s, int flush);
+#endif
 static void lm_set_level         (deflate_state *s, int level);
 static void lm_init              (deflate_state *s);
+#ifndef ZLIB_COMPAT
+static int deflate_resume        (deflate_state *s);
+static int deflate_own_head      (deflate_state *s);
+static void free_head            (deflate_state *s, Pos *head);
+/* Whether the buffers of s are there, or could be taken back after deflateHibernate() */
+#  define DEFLATE_RESUME(s) ((s)->pending_buf != NULL || deflate_resume(s) == Z_OK)
+/* Whether s may change head, which it might share with other streams after deflateFork() */
+#  define DEFLATE_OWN_HEAD(s) ((s)->head_next == NULL || deflate_own_head(s) == Z_OK)
+#else
+#  define DEFLATE_RESUME(s) 1
+#  define DEFLATE_OWN_HEAD(s) 1
+#endif
 Z_INTERNAL unsigned read_buf  (PREFIX3(stream) *strm, unsigned char *buf, unsigned size);
 
 extern void crc_reset(deflate_state *const s);
@@ -120,10 +136,6 @@ extern void crc_finalize(deflate_state *const s);
 #endif
 extern void copy_with_crc(PREFIX3(stream) *strm, unsigned char *dst, unsigned long size);
 
-extern uint32_t update_hash_roll        (deflate_state *const s, uint32_t h, uint32_t val);
-extern void     insert_string_roll      (deflate_state *const s, uint32_t str, uint32_t count);
-extern Pos      quick_insert_string_roll(deflate_state *const s, uint32_t str);
-
 /* ===========================================================================
  * Local data
  */
@@ -149,7 +161,7 @@ static const config configuration_table[10] = {
 /* 1 */ {4,    4,  8,    4, deflate_fast}, /* max speed, no lazy matches */
 /* 2 */ {4,    5, 16,    8, deflate_fast},
 #else
-/* 1 */ {0,    0,  0,    0, deflate_quick},
+/* 1 */ {4,    4,  8,    4, deflate_quick}, /* limits only used by Z_ADAPTIVE */
 /* 2 */ {4,    4,  8,    4, deflate_fast}, /* max speed, no lazy matches */
 #endif
 
@@ -199,11 +211,7 @@ int32_t Z_EXPORT PREFIX(deflateInit2_)(PREFIX3(stream) *strm, int32_t level, int
     int wrap = 1;
     static const char my_version[] = PREFIX2(VERSION);
 
-#if defined(X86_FEATURES)
-    x86_check_features();
-#elif defined(ARM_FEATURES)
-    arm_check_features();
-#endif
+    functable_init();
 
     if (version == NULL || version[0] != my_version[0] || stream_size != sizeof(PREFIX3(stream))) {
         return Z_VERSION_ERROR;
@@ -232,7 +240,7 @@ int32_t Z_EXPORT PREFIX(deflateInit2_)(PREFIX3(stream) *strm, int32_t level, int
 #endif
     }
     if (memLevel < 1 || memLevel > MAX_MEM_LEVEL || method != Z_DEFLATED || windowBits < 8 ||
-        windowBits > 15 || level < 0 || level > 9 || strategy < 0 || strategy > Z_FIXED ||
+        windowBits > 15 || level < 0 || level > 9 || strategy < 0 || strategy > MAX_STRATEGY ||
         (windowBits == 8 && wrap != 1)) {
         return Z_STREAM_ERROR;
     }
@@ -245,6 +253,10 @@ int32_t Z_EXPORT PREFIX(deflateInit2_)(PREFIX3(stream) *strm, int32_t level, int
     strm->state = (struct internal_state *)s;
     s->strm = strm;
     s->status = INIT_STATE;     /* to pass state test in deflateReset() */
+#ifndef ZLIB_COMPAT
+    s->hash_map = NULL;
+    s->head_next = NULL;
+#endif
 
     s->wrap = wrap;
     s->gzhead = NULL;
@@ -252,11 +264,13 @@ int32_t Z_EXPORT PREFIX(deflateInit2_)(PREFIX3(stream) *strm, int32_t level, int
     s->w_size = 1 << s->w_bits;
     s->w_mask = s->w_size - 1;
 
-#ifdef X86_PCLMULQDQ_CRC
+    /* For the reads past the end of the window of PCLMULQDQ crc32 and of the
+     * 8 byte keys of insert_string_mul() */
     window_padding = 8;
-#endif
 
     s->window = (unsigned char *) ZALLOC_WINDOW(strm, s->w_size + window_padding, 2*sizeof(unsigned char));
+    if (s->window != NULL)
+        memset(s->window + 2 * s->w_size, 0, 2 * window_padding);
     s->prev   = (Pos *)  ZALLOC(strm, s->w_size, sizeof(Pos));
     memset(s->prev, 0, s->w_size * sizeof(Pos));
     s->head   = (Pos *)  ZALLOC(strm, HASH_SIZE, sizeof(Pos));
@@ -302,9 +316,14 @@ int32_t Z_EXPORT PREFIX(deflateInit2_)(PREFIX3(stream) *strm, int32_t level, int
      * Therefore its average symbol length is assured to be less than 31. So
      * the compressed data for a dynamic block also cannot overwrite the
      * symbols from which it is being constructed.
+     *
+     * With LIT_MEM, pending_buf has a fifth part for l_buf, and d_buf starts
+     * halfway into the first four parts. Each symbol consumed then frees two
+     * bytes of d_buf, and the 31*(n-2) bits written stay below the 16*n+16*(n-2)
+     * bits of d_buf read, so the same holds with more room to spare.
      */
 
-    s->pending_buf = (unsigned char *) ZALLOC(strm, s->lit_bufsize, 4);
+    s->pending_buf = (unsigned char *) ZALLOC(strm, s->lit_bufsize, LIT_BUFS);
     s->pending_buf_size = s->lit_bufsize * 4;
 
     if (s->window == NULL || s->prev == NULL || s->head == NULL || s->pending_buf == NULL) {
@@ -313,8 +332,14 @@ int32_t Z_EXPORT PREFIX(deflateInit2_)(PREFIX3(stream) *strm, int32_t level, int
         PREFIX(deflateEnd)(strm);
         return Z_MEM_ERROR;
     }
+#ifdef LIT_MEM
+    s->d_buf = (uint16_t *)(s->pending_buf + (s->lit_bufsize << 1));
+    s->l_buf = s->pending_buf + (s->lit_bufsize << 2);
+    s->sym_end = s->lit_bufsize - 1;
+#else
     s->sym_buf = s->pending_buf + s->lit_bufsize;
     s->sym_end = (s->lit_bufsize - 1) * 3;
+#endif
     /* We avoid equality with lit_bufsize*3 because of wraparound at 64K
      * on 16 bit machines and because stored blocks are restricted to
      * 64K-1 bytes.
@@ -324,7 +349,7 @@ int32_t Z_EXPORT PREFIX(deflateInit2_)(PREFIX3(stream) *strm, int32_t level, int
     s->strategy = strategy;
     s->block_open = 0;
     s->reproducible = 0;
-
+    s->hash_len = HASH_LEN;
     return PREFIX(deflateReset)(strm);
 }
 
@@ -361,6 +386,8 @@ int32_t Z_EXPORT PREFIX(deflateSetDictionary)(PREFIX3(stream) *strm, const uint8
     if (deflateStateCheck(strm) || dictionary == NULL)
         return Z_STREAM_ERROR;
     s = strm->state;
+    if (!DEFLATE_RESUME(s) || !DEFLATE_OWN_HEAD(s))
+        return Z_MEM_ERROR;
     wrap = s->wrap;
     if (wrap == 2 || (wrap == 1 && s->status != INIT_STATE) || s->lookahead)
         return Z_STREAM_ERROR;
@@ -392,7 +419,7 @@ int32_t Z_EXPORT PREFIX(deflateSetDictionary)(PREFIX3(stream) *strm, const uint8
     while (s->lookahead >= STD_MIN_MATCH) {
         str = s->strstart;
         n = s->lookahead - (STD_MIN_MATCH - 1);
-        functable.insert_string(s, str, n);
+        s->insert_string(s, str, n);
         s->strstart = str + n;
         s->lookahead = STD_MIN_MATCH - 1;
         fill_window(s);
@@ -409,6 +436,141 @@ int32_t Z_EXPORT PREFIX(deflateSetDictionary)(PREFIX3(stream) *strm, const uint8
     return Z_OK;
 }
 
+#ifndef ZLIB_COMPAT
+/* Dictionary inserted once in the window and hash tables of a stream, see
+ * zng_deflateDictionaryCreate(). Never changed once created. */
+struct zng_deflate_dictionary_s {
+    free_func zfree;                /* to free the dictionary with */
+    void *opaque;
+    unsigned int w_bits;            /* window of the stream it was created with */
+    unsigned int hash_len;          /* bytes hashed and ... */
+    insert_string_cb insert_string; /* ... function hashing them into head and prev */
+    uint32_t adler;                 /* Adler-32 of the whole dictionary */
+    z_off64_t dict_len;             /* length of the whole dictionary */
+    uint32_t ins_h;
+    unsigned int kept;              /* bytes of the dictionary in window, at most 1 << MAX_WBITS */
+    unsigned int length;            /* bytes at the end of window in the window of the stream, at most w_size */
+    unsigned int insert;            /* bytes at the end of window left to insert */
+    unsigned int hashed;            /* positions in head and prev */
+    unsigned int tail;              /* positions after them to hash with the stream */
+    unsigned char *window;          /* dictionary bytes kept, for streams with a larger window too */
+    Pos *prev;                      /* hashed entries of prev */
+    Pos *head;                      /* HASH_SIZE entries of head */
+};
+
+/* ========================================================================= */
+zng_deflate_dictionary * Z_EXPORT zng_deflateDictionaryCreate(zng_stream *strm, const uint8_t *dictionary,
+                                                               uint32_t dictLength) {
+    zng_deflate_dictionary *dict;
+    deflate_state *s;
+    unsigned char *buf;
+    unsigned int inserted, hashed, key_len, kept;
+    size_t size;
+
+    if (deflateStateCheck(strm) || dictionary == NULL)
+        return NULL;
+    s = strm->state;
+    if (s->strstart != 0 || s->lookahead != 0)
+        return NULL;
+    if (PREFIX(deflateSetDictionary)(strm, dictionary, dictLength) != Z_OK)
+        return NULL;
+
+    /* The keys of the last positions read past the dictionary, into whatever the window of the
+     * stream held before, so only the positions before them are kept hashed and the others are
+     * hashed again by each stream that uses the dictionary */
+    inserted = s->strstart >= STD_MIN_MATCH ? s->strstart - (STD_MIN_MATCH - 1) : 0;
+    key_len = s->insert_string == &insert_string_roll ? STD_MIN_MATCH : s->hash_len;
+    hashed = s->strstart >= key_len ? s->strstart - key_len + 1 : 0;
+    hashed = MIN(hashed, inserted);
+
+    /* As much of the dictionary as the largest window takes, for the streams that hash it again */
+    kept = MIN(dictLength, 1U << MAX_WBITS);
+    size = sizeof(zng_deflate_dictionary) + HASH_SIZE * sizeof(Pos) + hashed * sizeof(Pos) + kept;
+    buf = (unsigned char *)strm->zalloc(strm->opaque, 1, (unsigned)size);
+    if (buf == NULL)
+        return NULL;
+    dict = (zng_deflate_dictionary *)buf;
+    dict->head = (Pos *)(buf + sizeof(zng_deflate_dictionary));
+    dict->prev = dict->head + HASH_SIZE;
+    dict->window = (unsigned char *)(dict->prev + hashed);
+
+    /* Hash the kept positions again from an empty table, then the tail as before */
+    CLEAR_HASH(s);
+    s->ins_h = 0;
+    if (hashed)
+        s->insert_string(s, 0, hashed);
+
+    dict->zfree = strm->zfree;
+    dict->opaque = strm->opaque;
+    dict->w_bits = s->w_bits;
+    dict->hash_len = s->hash_len;
+    dict->insert_string = s->insert_string;
+    dict->adler = functable.adler32(ADLER32_INITIAL_VALUE, dictionary, dictLength);
+    dict->dict_len = dictLength;
+    dict->ins_h = s->ins_h;
+    dict->kept = kept;
+    dict->length = s->strstart;
+    dict->insert = s->insert;
+    dict->hashed = hashed;
+    dict->tail = inserted - hashed;
+    memcpy(dict->window, dictionary + dictLength - kept, kept);
+    memcpy(dict->prev, s->prev, hashed * sizeof(Pos));
+    memcpy(dict->head, s->head, HASH_SIZE * sizeof(Pos));
+    if (dict->tail)
+        s->insert_string(s, hashed, dict->tail);
+    return dict;
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_deflateUseDictionary(zng_stream *strm, const zng_deflate_dictionary *dict) {
+    deflate_state *s;
+    uint32_t adler;
+    int32_t ret;
+
+    if (deflateStateCheck(strm) || dict == NULL)
+        return Z_STREAM_ERROR;
+    s = strm->state;
+    if (!DEFLATE_RESUME(s) || !DEFLATE_OWN_HEAD(s))
+        return Z_MEM_ERROR;
+    if (s->wrap == 2 || (s->wrap == 1 && s->status != INIT_STATE) || s->lookahead)
+        return Z_STREAM_ERROR;
+    adler = strm->adler;
+
+    /* Only an empty stream hashing the same way can take the tables as they are */
+    if (s->strstart != 0 || s->w_bits != dict->w_bits || s->hash_len != dict->hash_len ||
+        s->insert_string != dict->insert_string) {
+        ret = PREFIX(deflateSetDictionary)(strm, dict->window, dict->kept);
+        if (ret != Z_OK)
+            return ret;
+    } else {
+        const unsigned char *window = dict->window + dict->kept - dict->length;
+
+        DEFLATE_SET_DICTIONARY_HOOK(strm, window, dict->length);  /* hook for IBM Z DFLTCC */
+        memcpy(s->window, window, dict->length);
+        memcpy(s->prev, dict->prev, dict->hashed * sizeof(Pos));
+        memcpy(s->head, dict->head, HASH_SIZE * sizeof(Pos));
+        s->ins_h = dict->ins_h;
+        if (dict->tail)
+            s->insert_string(s, dict->hashed, dict->tail);
+        s->strstart = dict->length;
+        s->block_start = (int)s->strstart;
+        s->insert = dict->insert;
+        s->prev_length = 0;
+        s->match_available = 0;
+    }
+    /* The Adler-32 of the dictionary covers all of it, not only the bytes kept */
+    if (s->wrap == 1)
+        strm->adler = zng_adler32_combine(adler, dict->adler, dict->dict_len);
+    return Z_OK;
+}
+
+/* ========================================================================= */
+void Z_EXPORT zng_deflateDictionaryFree(zng_deflate_dictionary *dict) {
+    if (dict != NULL)
+        dict->zfree(dict->opaque, dict);
+}
+#endif
+
 /* ========================================================================= */
 int32_t Z_EXPORT PREFIX(deflateGetDictionary)(PREFIX3(stream) *strm, uint8_t *dictionary, uint32_t *dictLength) {
     deflate_state *s;
@@ -434,6 +596,8 @@ int32_t Z_EXPORT PREFIX(deflateResetKeep)(PREFIX3(stream) *strm) {
 
     if (deflateStateCheck(strm))
         return Z_STREAM_ERROR;
+    if (!DEFLATE_RESUME(strm->state) || !DEFLATE_OWN_HEAD(strm->state))
+        return Z_MEM_ERROR;
 
     strm->total_in = strm->total_out = 0;
     strm->msg = NULL; /* use zfree if we ever allocate msg dynamically */
@@ -459,6 +623,13 @@ int32_t Z_EXPORT PREFIX(deflateResetKeep)(PREFIX3(stream) *strm) {
 #endif
         strm->adler = ADLER32_INITIAL_VALUE;
     s->last_flush = -2;
+#ifndef ZLIB_COMPAT
+    s->seqs = NULL;
+    s->seq_left = 0;
+    s->seq_call = 0;
+    s->seq_block = 0;
+    s->seq_error = 0;
+#endif
 
     zng_tr_init(s);
 
@@ -505,8 +676,14 @@ int32_t Z_EXPORT PREFIX(deflatePrime)(PREFIX3(stream) *strm, int32_t bits, int32
     if (deflateStateCheck(strm))
         return Z_STREAM_ERROR;
     s = strm->state;
+    if (!DEFLATE_RESUME(s))
+        return Z_MEM_ERROR;
     if (bits < 0 || bits > BIT_BUF_SIZE || bits > (int32_t)(sizeof(value) << 3) ||
+#ifdef LIT_MEM
+        (unsigned char *)s->d_buf < s->pending_out + ((BIT_BUF_SIZE + 7) >> 3))
+#else
         s->sym_buf < s->pending_out + ((BIT_BUF_SIZE + 7) >> 3))
+#endif
         return Z_BUF_ERROR;
     do {
         put = BIT_BUF_SIZE - s->bi_valid;
@@ -536,8 +713,10 @@ int32_t Z_EXPORT PREFIX(deflateParams)(PREFIX3(stream) *strm, int32_t level, int
 
     if (level == Z_DEFAULT_COMPRESSION)
         level = 6;
-    if (level < 0 || level > 9 || strategy < 0 || strategy > Z_FIXED)
+    if (level < 0 || level > 9 || strategy < 0 || strategy > MAX_STRATEGY)
         return Z_STREAM_ERROR;
+    if (!DEFLATE_RESUME(s) || !DEFLATE_OWN_HEAD(s))
+        return Z_MEM_ERROR;
     DEFLATE_PARAMS_HOOK(strm, level, strategy, &hook_flush);  /* hook for IBM Z DFLTCC */
     func = configuration_table[s->level].func;
 
@@ -710,6 +889,15 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
     if (strm->avail_out == 0) {
         ERR_RETURN(strm, Z_BUF_ERROR);
     }
+    if (!DEFLATE_RESUME(s) || !DEFLATE_OWN_HEAD(s)) {
+        ERR_RETURN(strm, Z_MEM_ERROR);
+    }
+#ifndef ZLIB_COMPAT
+    /* Only deflateSequences() knows how to go on with the block it started */
+    if (s->seq_block && !s->seq_call) {
+        ERR_RETURN(strm, Z_STREAM_ERROR);
+    }
+#endif
 
     old_flush = s->last_flush;
     s->last_flush = flush;
@@ -749,7 +937,7 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
         unsigned int header = (Z_DEFLATED + ((s->w_bits-8)<<4)) << 8;
         unsigned int level_flags;
 
-        if (s->strategy >= Z_HUFFMAN_ONLY || s->level < 2)
+        if ((s->strategy >= Z_HUFFMAN_ONLY && s->strategy != Z_ADAPTIVE) || s->level < 2)
             level_flags = 0;
         else if (s->level < 6)
             level_flags = 1;
@@ -788,7 +976,7 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
             put_uint32(s, 0);
             put_byte(s, 0);
             put_byte(s, s->level == 9 ? 2 :
-                     (s->strategy >= Z_HUFFMAN_ONLY || s->level < 2 ? 4 : 0));
+                     ((s->strategy >= Z_HUFFMAN_ONLY && s->strategy != Z_ADAPTIVE) || s->level < 2 ? 4 : 0));
             put_byte(s, OS_CODE);
             s->status = BUSY_STATE;
 
@@ -806,7 +994,7 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
                      (s->gzhead->comment == NULL ? 0 : 16)
                      );
             put_uint32(s, s->gzhead->time);
-            put_byte(s, s->level == 9 ? 2 : (s->strategy >= Z_HUFFMAN_ONLY || s->level < 2 ? 4 : 0));
+            put_byte(s, s->level == 9 ? 2 : ((s->strategy >= Z_HUFFMAN_ONLY && s->strategy != Z_ADAPTIVE) || s->level < 2 ? 4 : 0));
             put_byte(s, s->gzhead->os & 0xff);
             if (s->gzhead->extra != NULL)
                 put_short(s, (uint16_t)s->gzhead->extra_len);
@@ -915,11 +1103,17 @@ int32_t Z_EXPORT PREFIX(deflate)(PREFIX3(stream) *strm, int32_t flush) {
     if (strm->avail_in != 0 || s->lookahead != 0 || (flush != Z_NO_FLUSH && s->status != FINISH_STATE)) {
         block_state bstate;
 
+#ifndef ZLIB_COMPAT
+        if (s->seq_call)
+            bstate = deflate_sequences(s, flush);
+        else
+#endif
         bstate = DEFLATE_HOOK(strm, flush, &bstate) ? bstate :  /* hook for IBM Z DFLTCC */
                  s->level == 0 ? deflate_stored(s, flush) :
                  s->strategy == Z_HUFFMAN_ONLY ? deflate_huff(s, flush) :
                  s->strategy == Z_RLE ? deflate_rle(s, flush) :
-                 (*(configuration_table[s->level].func))(s, flush);
+                 s->strategy == Z_ADAPTIVE ? deflate_adaptive(s, flush) :
+                 s->compress(s, flush);
 
         if (bstate == finish_started || bstate == finish_done) {
             s->status = FINISH_STATE;
@@ -1001,9 +1195,16 @@ int32_t Z_EXPORT PREFIX(deflateEnd)(PREFIX3(stream) *strm) {
 
     /* Deallocate in reverse order of allocations: */
     TRY_FREE(strm, strm->state->pending_buf);
+#ifndef ZLIB_COMPAT
+    free_head(strm->state, strm->state->head);
+#else
     TRY_FREE(strm, strm->state->head);
+#endif
     TRY_FREE(strm, strm->state->prev);
     TRY_FREE_WINDOW(strm, strm->state->window);
+#ifndef ZLIB_COMPAT
+    TRY_FREE(strm, strm->state->hash_map);
+#endif
 
     ZFREE_STATE(strm, strm->state);
     strm->state = NULL;
@@ -1023,6 +1224,8 @@ int32_t Z_EXPORT PREFIX(deflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
         return Z_STREAM_ERROR;
 
     ss = source->state;
+    if (!DEFLATE_RESUME(ss))
+        return Z_MEM_ERROR;
 
     memcpy((void *)dest, (void *)source, sizeof(PREFIX3(stream)));
 
@@ -1032,28 +1235,34 @@ int32_t Z_EXPORT PREFIX(deflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
     dest->state = (struct internal_state *) ds;
     ZCOPY_STATE((void *)ds, (void *)ss, sizeof(deflate_state));
     ds->strm = dest;
+#ifndef ZLIB_COMPAT
+    ds->head_next = NULL;
+#endif
 
-#ifdef X86_PCLMULQDQ_CRC
     window_padding = 8;
-#endif
 
     ds->window = (unsigned char *) ZALLOC_WINDOW(dest, ds->w_size + window_padding, 2*sizeof(unsigned char));
     ds->prev   = (Pos *)  ZALLOC(dest, ds->w_size, sizeof(Pos));
     ds->head   = (Pos *)  ZALLOC(dest, HASH_SIZE, sizeof(Pos));
-    ds->pending_buf = (unsigned char *) ZALLOC(dest, ds->lit_bufsize, 4);
+    ds->pending_buf = (unsigned char *) ZALLOC(dest, ds->lit_bufsize, LIT_BUFS);
 
     if (ds->window == NULL || ds->prev == NULL || ds->head == NULL || ds->pending_buf == NULL) {
         PREFIX(deflateEnd)(dest);
         return Z_MEM_ERROR;
     }
 
-    memcpy(ds->window, ss->window, ds->w_size * 2 * sizeof(unsigned char));
+    memcpy(ds->window, ss->window, (ds->w_size + window_padding) * 2 * sizeof(unsigned char));
     memcpy((void *)ds->prev, (void *)ss->prev, ds->w_size * sizeof(Pos));
     memcpy((void *)ds->head, (void *)ss->head, HASH_SIZE * sizeof(Pos));
-    memcpy(ds->pending_buf, ss->pending_buf, ds->pending_buf_size);
+    memcpy(ds->pending_buf, ss->pending_buf, ds->lit_bufsize * LIT_BUFS);
 
     ds->pending_out = ds->pending_buf + (ss->pending_out - ss->pending_buf);
+#ifdef LIT_MEM
+    ds->d_buf = (uint16_t *)(ds->pending_buf + (ds->lit_bufsize << 1));
+    ds->l_buf = ds->pending_buf + (ds->lit_bufsize << 2);
+#else
     ds->sym_buf = ds->pending_buf + ds->lit_bufsize;
+#endif
 
     ds->l_desc.dyn_tree = ds->dyn_ltree;
     ds->d_desc.dyn_tree = ds->dyn_dtree;
@@ -1062,6 +1271,323 @@ int32_t Z_EXPORT PREFIX(deflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
     return Z_OK;
 }
 
+#ifndef ZLIB_COMPAT
+/* ===========================================================================
+ * Take s out of the ring of streams that share its head.
+ */
+static void unlink_head(deflate_state *s) {
+    deflate_state *p = s->head_next;
+
+    while (p->head_next != s)
+        p = p->head_next;
+    p->head_next = s->head_next == p ? NULL : s->head_next;
+    s->head_next = NULL;
+}
+
+/* ===========================================================================
+ * Free head, unless other streams still share it.
+ */
+static void free_head(deflate_state *s, Pos *head) {
+    if (s->head_next != NULL)
+        unlink_head(s);
+    else
+        TRY_FREE(s->strm, head);
+}
+
+/* ===========================================================================
+ * Give s a copy of the head it shares with other streams, before it changes it.
+ */
+static int deflate_own_head(deflate_state *s) {
+    Pos *head = (Pos *) ZALLOC(s->strm, HASH_SIZE, sizeof(Pos));
+
+    if (head == NULL)
+        return Z_MEM_ERROR;
+    memcpy((void *)head, (void *)s->head, HASH_SIZE * sizeof(Pos));
+    unlink_head(s);
+    s->head = head;
+    return Z_OK;
+}
+
+/* =========================================================================
+ * Copy the source state to the destination state like deflateCopy(), but only
+ * the parts of the buffers in use, into the buffers of dest if it already has
+ * some of the same sizes, and with head shared until one of them changes it.
+ */
+int32_t Z_EXPORT zng_deflateFork(zng_stream *dest, zng_stream *source) {
+    deflate_state *ds;
+    deflate_state *ss;
+    unsigned char *window, *pending_buf;
+    Pos *prev, *head;
+    uint32_t window_padding = 8, used;
+
+    if (deflateStateCheck(source) || dest == NULL || dest == source)
+        return Z_STREAM_ERROR;
+    ss = source->state;
+    if (!DEFLATE_RESUME(ss))
+        return Z_MEM_ERROR;
+
+    /* Keep the buffers of dest only if they are as large and freed the same way */
+    ds = NULL;
+    if (dest->state != NULL && !deflateStateCheck(dest)) {
+        ds = dest->state;
+        if (ds->pending_buf == NULL || ds->w_bits != ss->w_bits || ds->lit_bufsize != ss->lit_bufsize || dest->zalloc != source->zalloc ||
+            dest->zfree != source->zfree || dest->opaque != source->opaque) {
+            PREFIX(deflateEnd)(dest);
+            ds = NULL;
+        }
+    }
+
+    memcpy((void *)dest, (void *)source, sizeof(zng_stream));
+    if (ds == NULL) {
+        ds = (deflate_state *) ZALLOC_STATE(dest, 1, sizeof(deflate_state));
+        if (ds == NULL)
+            return Z_MEM_ERROR;
+        dest->state = (struct internal_state *) ds;
+        ZCOPY_STATE((void *)ds, (void *)ss, sizeof(deflate_state));
+        ds->head_next = NULL;
+        ds->head = NULL;
+        ds->window = (unsigned char *) ZALLOC_WINDOW(dest, ds->w_size + window_padding, 2*sizeof(unsigned char));
+        ds->prev   = (Pos *)  ZALLOC(dest, ds->w_size, sizeof(Pos));
+        ds->pending_buf = (unsigned char *) ZALLOC(dest, ds->lit_bufsize, LIT_BUFS);
+        if (ds->window == NULL || ds->prev == NULL || ds->pending_buf == NULL) {
+            PREFIX(deflateEnd)(dest);
+            return Z_MEM_ERROR;
+        }
+        memset(ds->window + 2 * ds->w_size, 0, 2 * window_padding);
+        head = NULL;
+    } else {
+        /* A head of its own is overwritten, one shared with other streams is left to them */
+        if (ds->head_next != NULL) {
+            unlink_head(ds);
+            ds->head = NULL;
+        }
+        window = ds->window;
+        prev = ds->prev;
+        head = ds->head;
+        pending_buf = ds->pending_buf;
+        dest->state = (struct internal_state *) ds;
+        ZCOPY_STATE((void *)ds, (void *)ss, sizeof(deflate_state));
+        ds->window = window;
+        ds->prev = prev;
+        ds->pending_buf = pending_buf;
+    }
+    ds->strm = dest;
+
+    /* The window is only read up to where it was written or cleared, and prev only
+     * for positions in the window, all below w_size until the window slides */
+    used = MIN(ss->window_size, MAX(ss->high_water, ss->strstart + ss->lookahead));
+    memcpy(ds->window, ss->window, used);
+    used = MIN(ss->w_size, ss->strstart + ss->lookahead);
+    memcpy((void *)ds->prev, (void *)ss->prev, used * sizeof(Pos));
+
+    /* head is taken over as a whole, copying it is left to deflate_own_head() of
+     * the first stream to change it, unless dest already has one of its own */
+    if (head != NULL) {
+        ds->head = head;
+        ds->head_next = NULL;
+        memcpy((void *)ds->head, (void *)ss->head, HASH_SIZE * sizeof(Pos));
+    } else {
+        ds->head = ss->head;
+        ds->head_next = ss->head_next != NULL ? ss->head_next : ss;
+        ss->head_next = ds;
+    }
+
+    /* Of pending_buf, only the pending output and the symbols of the current block */
+    used = (uint32_t)(ss->pending_out - ss->pending_buf) + ss->pending;
+    memcpy(ds->pending_buf, ss->pending_buf, used);
+    ds->pending_out = ds->pending_buf + (ss->pending_out - ss->pending_buf);
+#ifdef LIT_MEM
+    ds->d_buf = (uint16_t *)(ds->pending_buf + (ds->lit_bufsize << 1));
+    ds->l_buf = ds->pending_buf + (ds->lit_bufsize << 2);
+    memcpy(ds->d_buf, ss->d_buf, ss->sym_next * sizeof(uint16_t));
+    memcpy(ds->l_buf, ss->l_buf, ss->sym_next);
+#else
+    ds->sym_buf = ds->pending_buf + ds->lit_bufsize;
+    memcpy(ds->sym_buf, ss->sym_buf, ss->sym_next);
+#endif
+
+    ds->l_desc.dyn_tree = ds->dyn_ltree;
+    ds->d_desc.dyn_tree = ds->dyn_dtree;
+    ds->bl_desc.dyn_tree = ds->bl_tree;
+
+    return Z_OK;
+}
+
+/* ===========================================================================
+ * First window position of s->hash_map. Positions before it are more than a
+ * window back from strstart, too far for a match from now on, so that links
+ * to them lead nowhere, like links to 0.
+ */
+static uint32_t hash_map_start(deflate_state *s) {
+    return s->strstart > s->w_size ? s->strstart - s->w_size : 0;
+}
+
+/* ===========================================================================
+ * Mark in s->hash_map the positions found in the hash chains, following each
+ * chain back for as long as it stays in the window. Links only lead back, so
+ * that a single pass from the end of the window follows all of the chains.
+ */
+#define HASH_MAP_TEST(s, i) ((s)->hash_map[(i) >> 3] & (1 << ((i) & 7)))
+
+/* Set bit i of s->hash_map if set is 1, without a branch the data would mispredict */
+static inline void hash_map_set(deflate_state *s, uint32_t i, uint32_t set) {
+    i &= s->w_mask;
+    s->hash_map[i >> 3] |= (unsigned char)(set << (i & 7));
+}
+
+static void map_hash_chains(deflate_state *s) {
+    uint32_t start = hash_map_start(s), h, i, link;
+    Pos str;
+
+    memset(s->hash_map, 0, s->w_size >> 3);
+    for (h = 0; h < HASH_SIZE; h++) {
+        str = s->head[h];
+        link = str - start;
+        hash_map_set(s, link, (str != 0) & (link < s->w_size));
+    }
+    for (i = s->w_size; i-- > 0; ) {
+        str = s->prev[(start + i) & s->w_mask];
+        link = str - start;
+        hash_map_set(s, link, (HASH_MAP_TEST(s, i) != 0) & (str != 0) & (link < i));
+    }
+}
+
+/* ===========================================================================
+ * Hash the positions marked in s->hash_map into head and prev again, in the
+ * order in which deflate inserted them.
+ */
+static void rehash_window(deflate_state *s) {
+    uint32_t start = hash_map_start(s), ins_h = s->ins_h, i, str;
+
+    CLEAR_HASH(s);
+    memset(s->prev, 0, s->w_size * sizeof(Pos));
+    for (i = 0; i < s->w_size; i++) {
+        if (HASH_MAP_TEST(s, i)) {
+            str = start + i;
+            /* The rolling hash takes the bytes before the last one from ins_h */
+            s->ins_h = s->update_hash(s, s->window[str], s->window[str + 1]);
+            s->quick_insert_string(s, str);
+        }
+    }
+    s->ins_h = ins_h;
+}
+
+/* ===========================================================================
+ * Whether two links of the hash chains lead to the same match candidates.
+ */
+static inline int same_link(Pos a, Pos b, uint32_t start) {
+    return a == b || (a < start && b < start);
+}
+
+/* ========================================================================= */
+int32_t Z_EXPORT zng_deflateHibernate(zng_stream *strm) {
+    deflate_state *s;
+    Pos *head, *prev, *old_head, *old_prev;
+    uint32_t start, i;
+    int same;
+
+    if (deflateStateCheck(strm))
+        return Z_STREAM_ERROR;
+    s = strm->state;
+    if (s->pending_buf == NULL)
+        return Z_OK;
+    /* pending_buf must hold no output and no symbols of an unfinished block */
+    if (s->pending != 0 || s->sym_next != 0)
+        return Z_BUF_ERROR;
+
+    ZFREE(strm, s->pending_buf);
+    s->pending_buf = NULL;
+    s->pending_out = NULL;
+#ifdef LIT_MEM
+    s->d_buf = NULL;
+    s->l_buf = NULL;
+#else
+    s->sym_buf = NULL;
+#endif
+
+    /* head and prev are only freed when hashing the window again gives chains
+     * that lead to the same match candidates. That is not the case when deflate
+     * skipped positions in a way that the chains do not show, or when the hash
+     * function changed with the level, and then they are kept. */
+    s->hash_map = (unsigned char *) ZALLOC(strm, s->w_size >> 3, 1);
+    head = (Pos *) ZALLOC(strm, HASH_SIZE, sizeof(Pos));
+    prev = (Pos *) ZALLOC(strm, s->w_size, sizeof(Pos));
+    if (s->hash_map == NULL || head == NULL || prev == NULL) {
+        TRY_FREE(strm, prev);
+        TRY_FREE(strm, head);
+        TRY_FREE(strm, s->hash_map);
+        s->hash_map = NULL;
+        return Z_OK;
+    }
+    map_hash_chains(s);
+
+    /* Rebuild into the new tables, and compare them with the old ones */
+    old_head = s->head;
+    old_prev = s->prev;
+    s->head = head;
+    s->prev = prev;
+    rehash_window(s);
+    start = hash_map_start(s);
+    same = 1;
+    for (i = 0; same && i < HASH_SIZE; i++)
+        same = same_link(old_head[i], head[i], start);
+    for (i = 0; same && i < s->w_size; i++)
+        same = same_link(old_prev[i], prev[i], start);
+
+    ZFREE(strm, prev);
+    ZFREE(strm, head);
+    if (same) {
+        ZFREE(strm, old_prev);
+        free_head(s, old_head);
+        s->prev = NULL;
+        s->head = NULL;
+    } else {
+        s->prev = old_prev;
+        s->head = old_head;
+        ZFREE(strm, s->hash_map);
+        s->hash_map = NULL;
+    }
+    return Z_OK;
+}
+
+/* ===========================================================================
+ * Allocate again the buffers freed by deflateHibernate(), and rebuild the hash
+ * chains if they went too.
+ */
+static int deflate_resume(deflate_state *s) {
+    PREFIX3(stream) *strm = s->strm;
+
+    s->pending_buf = (unsigned char *) ZALLOC(strm, s->lit_bufsize, LIT_BUFS);
+    if (s->pending_buf == NULL)
+        return Z_MEM_ERROR;
+    if (s->head == NULL) {
+        s->head = (Pos *) ZALLOC(strm, HASH_SIZE, sizeof(Pos));
+        s->prev = (Pos *) ZALLOC(strm, s->w_size, sizeof(Pos));
+        if (s->head == NULL || s->prev == NULL) {
+            TRY_FREE(strm, s->prev);
+            TRY_FREE(strm, s->head);
+            ZFREE(strm, s->pending_buf);
+            s->prev = NULL;
+            s->head = NULL;
+            s->pending_buf = NULL;
+            return Z_MEM_ERROR;
+        }
+        rehash_window(s);
+        ZFREE(strm, s->hash_map);
+        s->hash_map = NULL;
+    }
+
+    s->pending_out = s->pending_buf;
+#ifdef LIT_MEM
+    s->d_buf = (uint16_t *)(s->pending_buf + (s->lit_bufsize << 1));
+    s->l_buf = s->pending_buf + (s->lit_bufsize << 2);
+#else
+    s->sym_buf = s->pending_buf + s->lit_bufsize;
+#endif
+    return Z_OK;
+}
+#endif
+
 /* ===========================================================================
  * Read a new buffer from the current input stream, update the adler32
  * and total number of bytes read.  All deflate() input goes through
@@ -1099,11 +1625,29 @@ Z_INTERNAL unsigned read_buf(PREFIX3(stream) *strm, unsigned char *buf, unsigned
  * Set longest match variables based on level configuration
  */
 static void lm_set_level(deflate_state *s, int level) {
+    compress_func func  = configuration_table[level].func;
+    int long_keys = s->hash_len != HASH_LEN && configuration_table[level].max_chain <= 1024;
+
     s->max_lazy_match   = configuration_table[level].max_lazy;
     s->good_match       = configuration_table[level].good_length;
     s->nice_match       = configuration_table[level].nice_length;
     s->max_chain_length = configuration_table[level].max_chain;
 
+    /* The match finding strategies are built once per instruction set tier, use
+     * the build that functable selected for this cpu. Only the generic build
+     * hashes through s->quick_insert_string, which longer keys need. */
+    if (!long_keys) {
+        if (func == deflate_fast)
+            func = functable.deflate_fast;
+#ifndef NO_MEDIUM_STRATEGY
+        else if (func == deflate_medium)
+            func = functable.deflate_medium;
+#endif
+        else if (func == deflate_slow)
+            func = functable.deflate_slow;
+    }
+    s->compress = func;
+
     /* Use rolling hash for deflate_slow algorithm with level 9. It allows us to
      * properly lookup different hash chains to speed up longest_match search. Since hashing
      * method changes depending on the level we cannot put this into functable. */
@@ -1111,6 +1655,11 @@ static void lm_set_level(deflate_state *s, int level) {
         s->update_hash = &update_hash_roll;
         s->insert_string = &insert_string_roll;
         s->quick_insert_string = &quick_insert_string_roll;
+    } else if (long_keys) {
+        s->update_hash = &update_hash_mul;
+        s->insert_string = &insert_string_mul;
+        s->quick_insert_string = &quick_insert_string_mul;
+        s->hash_key_mask = ~(uint64_t)0 >> (64 - 8 * s->hash_len);
     } else {
         s->update_hash = functable.update_hash;
         s->insert_string = functable.insert_string;
@@ -1139,6 +1688,11 @@ static void lm_init(deflate_state *s) {
     s->prev_length = 0;
     s->match_available = 0;
     s->match_start = 0;
+    s->match_depth = 0;
+    s->match_misses = 0;
+    s->blk_in = 0;
+    s->adapt_mode = ADAPT_LEVEL;
+    s->adapt_blocks = 0;
     s->ins_h = 0;
 }
 
@@ -1283,6 +1837,7 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
     zng_deflate_param_value *new_level = NULL;
     zng_deflate_param_value *new_strategy = NULL;
     zng_deflate_param_value *new_reproducible = NULL;
+    zng_deflate_param_value *new_hash_len = NULL;
     int param_buf_error;
     int version_error = 0;
     int buf_error = 0;
@@ -1311,6 +1866,9 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
             case Z_DEFLATE_REPRODUCIBLE:
                 param_buf_error = deflateSetParamPre(&new_reproducible, sizeof(int), &params[i]);
                 break;
+            case Z_DEFLATE_HASH_LENGTH:
+                param_buf_error = deflateSetParamPre(&new_hash_len, sizeof(int), &params[i]);
+                break;
             default:
                 params[i].status = Z_VERSION_ERROR;
                 version_error = 1;
@@ -1347,11 +1905,62 @@ int32_t Z_EXPORT zng_deflateSetParams(zng_stream *strm, zng_deflate_param_value
             stream_error = 1;
         }
     }
+    if (new_hash_len != NULL) {
+        val = *(int *)new_hash_len->buf;
+        if (val == 4 || val == 5 || val == 6 || val == 8) {
+            /* The hash chains of a hibernating stream are rebuilt with the function they were made with */
+            if ((unsigned int)val != s->hash_len && !DEFLATE_RESUME(s)) {
+                new_hash_len->status = Z_MEM_ERROR;
+                stream_error = 1;
+            } else if ((unsigned int)val != s->hash_len) {
+                s->hash_len = (unsigned int)val;
+                lm_set_level(s, s->level);
+            }
+        } else {
+            new_hash_len->status = Z_STREAM_ERROR;
+            stream_error = 1;
+        }
+    }
 
     /* Report version errors only if there are no real errors. */
     return stream_error ? Z_STREAM_ERROR : (version_error ? Z_VERSION_ERROR : Z_OK);
 }
 
+/* ========================================================================= */
+int32_t Z_EXPORT zng_deflateSequences(zng_stream *strm, zng_deflate_sequence *seqs, size_t *count, int32_t flush) {
+    deflate_state *s;
+    int32_t ret;
+
+    if (deflateStateCheck(strm) || count == NULL || (*count != 0 && seqs == NULL))
+        return Z_STREAM_ERROR;
+    s = strm->state;
+
+    /* The sequences parse the input from the start of a block on, which needs
+     * whatever deflate() left in the window to have been flushed */
+    if (!s->seq_block && (s->lookahead != 0 || (int)s->strstart != s->block_start || s->block_open))
+        ERR_RETURN(strm, Z_STREAM_ERROR);
+
+    s->seqs = seqs;
+    s->seq_left = *count;
+    s->seq_error = 0;
+    /* The sequences left may only cover input already in the window, which
+     * deflate() would not count as something to do */
+    if (*count != 0)
+        s->last_flush = -1;
+
+    s->seq_call = 1;
+    ret = PREFIX(deflate)(strm, flush);
+    s->seq_call = 0;
+
+    *count -= s->seq_left;
+    s->seqs = NULL;
+    s->seq_left = 0;
+    s->seq_block = s->lookahead != 0 || (int)s->strstart != s->block_start;
+    if (s->seq_error)
+        return Z_DATA_ERROR;
+    return ret;
+}
+
 /* ========================================================================= */
 int32_t Z_EXPORT zng_deflateGetParams(zng_stream *strm, zng_deflate_param_value *params, size_t count) {
     deflate_state *s;
@@ -1388,6 +1997,12 @@ int32_t Z_EXPORT zng_deflateGetParams(zng_stream *strm, zng_deflate_param_value
                 else
                     *(int *)params[i].buf = s->reproducible;
                 break;
+            case Z_DEFLATE_HASH_LENGTH:
+                if (params[i].size < sizeof(int))
+                    params[i].status = Z_BUF_ERROR;
+                else
+                    *(int *)params[i].buf = (int)s->hash_len;
+                break;
             default:
                 params[i].status = Z_VERSION_ERROR;
                 version_error = 1;
@@ -52,6 +52,27 @@
 #define END_BLOCK 256
 /* end of block literal code */
 
+/* Z_ADAPTIVE is only offered by zlib-ng.h, the strategies of zlib.h end at Z_FIXED */
+#ifdef ZLIB_COMPAT
+#  define Z_ADAPTIVE   5
+#  define MAX_STRATEGY Z_FIXED
+#else
+#  define MAX_STRATEGY Z_ADAPTIVE
+#endif
+
+/* Tally the distances and literals/lengths in two arrays instead of one array
+ * of three byte symbols, at the cost of a fifth more memory for pending_buf */
+#ifndef NO_LIT_MEM
+#  define LIT_MEM
+#endif
+#ifdef LIT_MEM
+#  define LIT_BUFS 5
+#  define SYM_SIZE 1  /* sym_next counts symbols */
+#else
+#  define LIT_BUFS 4
+#  define SYM_SIZE 3  /* sym_next counts bytes of sym_buf */
+#endif
+
 #define INIT_STATE    42    /* zlib header -> BUSY_STATE */
 #ifdef GZIP
 #  define GZIP_STATE  57    /* gzip header -> BUSY_STATE | EXTRA_STATE */
@@ -70,6 +91,8 @@
 #endif
 #define HASH_MASK (HASH_SIZE - 1u) /* HASH_SIZE-1 */
 
+#define HASH_LEN     4u            /* bytes hashed by default, see Z_DEFLATE_HASH_LENGTH */
+
 
 /* Data structure describing a single value and its code string. */
 typedef struct ct_data_s {
@@ -108,6 +131,17 @@ typedef uint32_t (* update_hash_cb)        (deflate_state *const s, uint32_t h,
 typedef void     (* insert_string_cb)      (deflate_state *const s, uint32_t str, uint32_t count);
 typedef Pos      (* quick_insert_string_cb)(deflate_state *const s, uint32_t str);
 
+typedef enum {
+    need_more,      /* block not completed, need more input or more output */
+    block_done,     /* block flush performed */
+    finish_started, /* finish started, need only more output at next deflate */
+    finish_done,    /* finish done, accept no more input or output */
+    block_switch    /* block flushed, Z_ADAPTIVE may pick another match finder */
+} block_state;
+
+/* Compression function. Returns the block state after the call. */
+typedef block_state (* compress_func)(deflate_state *s, int flush);
+
 struct internal_state {
     PREFIX3(stream)      *strm;            /* pointer back to this zlib stream */
     unsigned char        *pending_buf;     /* output still pending */
@@ -165,6 +199,9 @@ struct internal_state {
 
     uint32_t ins_h; /* hash index of string to be inserted */
 
+    unsigned int hash_len;  /* bytes hashed to index head, HASH_LEN unless set by the application */
+    uint64_t hash_key_mask; /* keeps the first hash_len bytes of an 8 byte key, see insert_string_mul.c */
+
     int block_start;
     /* Window position at the beginning of the current output block. Gets
      * negative when the window is moved backwards.
@@ -202,6 +239,9 @@ struct internal_state {
     /* Hash function callbacks that can be configured depending on the deflate
      * algorithm being used */
 
+    compress_func           compress;
+    /* Strategy for the current level, built for the instruction set of this cpu */
+
     int level;    /* compression level (1..9) */
     int strategy; /* favor or force Huffman coding*/
 
@@ -228,15 +268,10 @@ struct internal_state {
     uint16_t bl_count[MAX_BITS+1];
     /* number of codes at each bit length for an optimal tree */
 
-    int heap[2*L_CODES+1];      /* heap used to build the Huffman trees */
-    int heap_len;               /* number of elements in the heap */
-    int heap_max;               /* element of largest frequency */
-    /* The sons of heap[n] are heap[2*n] and heap[2*n+1]. heap[0] is not used.
-     * The same heap array is used to build all trees.
-     */
-
-    unsigned char depth[2*L_CODES+1];
-    /* Depth of each subtree used as tie breaker for trees of equal frequency
+    uint32_t sorted[L_CODES+D_CODES]; /* codes of non zero frequency, least frequent first */
+    uint32_t weight[L_CODES];   /* their frequencies, then their bit lengths */
+    /* The same arrays are used to build all trees. The distance codes follow
+     * the literal/length codes in sorted until both trees are built.
      */
 
     unsigned int  lit_bufsize;
@@ -259,15 +294,51 @@ struct internal_state {
      *   - I can't count above 4
      */
 
+#ifdef LIT_MEM
+    uint16_t *d_buf;              /* buffer for distances */
+    unsigned char *l_buf;         /* buffer for literals/lengths */
+#else
     unsigned char *sym_buf;       /* buffer for distances and literals/lengths */
+#endif
     unsigned int sym_next;        /* running index in sym_buf */
     unsigned int sym_end;         /* symbol table full when sym_next reaches this */
+    unsigned int direct_lits;     /* literals ending the block that are encoded straight
+                                   * from the window instead of from sym_buf */
 
     unsigned long opt_len;        /* bit length of current block with optimal trees */
     unsigned long static_len;     /* bit length of current block with static trees */
     unsigned int matches;         /* number of string matches in current block */
+    unsigned int match_depth;     /* chain entries walked before finding match_start */
+    unsigned int match_misses;    /* positions in a row without a match, see deflate_skip() */
+
+    /* Contents of the last block flushed and the match finder chosen from them
+     * for the next one, only kept up to date with Z_ADAPTIVE, see deflate_adaptive.c */
+    unsigned int blk_in;          /* input bytes */
+    unsigned int blk_out;         /* compressed bytes */
+    unsigned int blk_lits;        /* literals */
+    unsigned int blk_matches;     /* matches */
+    unsigned int blk_near;        /* matches at distances up to 8 */
+    int adapt_mode;               /* match finder for the next block */
+    unsigned int adapt_blocks;    /* blocks since the level's match finder last ran */
+    unsigned int adapt_ratio;     /* compression ratio of the last Z_HUFFMAN_ONLY block, in 1/256 */
     unsigned int insert;          /* bytes at end of window left to insert */
 
+#ifndef ZLIB_COMPAT
+    /* Parse supplied by deflateSequences(), see deflate_sequences.c */
+    zng_deflate_sequence *seqs;   /* next sequence to send */
+    size_t seq_left;              /* number of sequences left to send */
+    int seq_call;                 /* set while deflateSequences() runs deflate() */
+    int seq_block;                /* the current block was started by deflateSequences() */
+    int seq_error;                /* the next sequence was refused */
+
+    /* Window positions in the hash chains, one bit each from strstart - w_size on, while
+     * deflateHibernate() has freed head and prev, see deflate_resume() */
+    unsigned char *hash_map;
+
+    /* Next of the streams that share head since deflateFork(), in a ring, or NULL */
+    deflate_state *head_next;
+#endif
+
     /* compressed_len and bits_sent are only used if ZLIB_DEBUG is defined */
     unsigned long compressed_len; /* total bit length of compressed file mod 2^32 */
     unsigned long bits_sent;      /* bit length of compressed data sent mod 2^32 */
@@ -285,13 +356,6 @@ struct internal_state {
     int32_t reserved[11];
 } ALIGNED_(8);
 
-typedef enum {
-    need_more,      /* block not completed, need more input or more output */
-    block_done,     /* block flush performed */
-    finish_started, /* finish started, need only more output at next deflate */
-    finish_done     /* finish done, accept no more input or output */
-} block_state;
-
 /* Output a byte on the stream.
  * IN assertion: there is enough room in pending_buf.
  */
@@ -397,6 +461,28 @@ static inline void put_uint64(deflate_state *s, uint64_t lld) {
 void Z_INTERNAL fill_window(deflate_state *s);
 void Z_INTERNAL slide_hash_c(deflate_state *s);
 
+        /* in insert_string_roll.c */
+uint32_t Z_INTERNAL update_hash_roll(deflate_state *const s, uint32_t h, uint32_t val);
+void Z_INTERNAL insert_string_roll(deflate_state *const s, uint32_t str, uint32_t count);
+Pos Z_INTERNAL quick_insert_string_roll(deflate_state *const s, uint32_t str);
+
+        /* in insert_string_mul.c */
+uint32_t Z_INTERNAL update_hash_mul(deflate_state *const s, uint32_t h, uint32_t val);
+void Z_INTERNAL insert_string_mul(deflate_state *const s, uint32_t str, uint32_t count);
+Pos Z_INTERNAL quick_insert_string_mul(deflate_state *const s, uint32_t str);
+
+        /* in deflate_skip.c */
+/* Positions in a row without a match after which deflate_medium and
+ * deflate_slow hand over to deflate_skip() */
+#define SKIP_TRIGGER 256
+int Z_INTERNAL deflate_skip(deflate_state *s, uint32_t (*longest_match)(deflate_state *const s, Pos cur_match));
+
+        /* in deflate_adaptive.c */
+/* Match finders Z_ADAPTIVE chooses from for each block */
+#define ADAPT_LEVEL 0   /* the one of the compression level */
+#define ADAPT_RLE   1
+#define ADAPT_HUFF  2
+
         /* in trees.c */
 void Z_INTERNAL zng_tr_init(deflate_state *s);
 void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_len, int last);
@@ -0,0 +1,115 @@
+/* deflate_adaptive.c -- choose the match finder for each block with Z_ADAPTIVE
+ *
+ * Copyright (C) 1995-2013 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "deflate.h"
+#include "deflate_p.h"
+#include "functable.h"
+
+Z_INTERNAL block_state deflate_quick(deflate_state *s, int flush);
+Z_INTERNAL block_state deflate_fast (deflate_state *s, int flush);
+Z_INTERNAL block_state deflate_rle  (deflate_state *s, int flush);
+Z_INTERNAL block_state deflate_huff (deflate_state *s, int flush);
+
+/* Blocks sent with Z_RLE or Z_HUFFMAN_ONLY before trying the match finder of
+ * the compression level again.
+ */
+#define ADAPT_PROBE 8
+
+/* Change in the compression ratio of Z_HUFFMAN_ONLY from one block to the next,
+ * in 1/256, taken as a sign that the data has changed.
+ */
+#define ADAPT_DRIFT 16
+
+/* ===========================================================================
+ * Choose the match finder for the next block from what the last one held:
+ * - When the level's match finder covered less than an eighth of the block
+ *   with matches, the data is close to incompressible or only gains from
+ *   Huffman coding, which deflate_huff does at a fraction of the cost.
+ *   zng_tr_flush_block still sends such blocks stored when that is shorter.
+ * - When nearly all its matches were at distances of 8 or less, the data is
+ *   made of runs and short periods, which deflate_rle finds without a hash
+ *   table.
+ * - Z_RLE gives way as soon as it covers less than half of a block and
+ *   Z_HUFFMAN_ONLY as soon as its ratio moves by more than ADAPT_DRIFT. Both
+ *   return to the level's match finder every ADAPT_PROBE blocks to check
+ *   whether the data has changed anyway.
+ */
+static void adapt_choose(deflate_state *s) {
+    uint32_t covered, ratio;
+
+    if (s->blk_in == 0)
+        return;
+    covered = s->blk_in - s->blk_lits;
+
+    if (s->adapt_mode == ADAPT_LEVEL) {
+        if (covered < s->blk_in / 8) {
+            s->adapt_mode = ADAPT_HUFF;
+            s->adapt_ratio = 0;
+        } else if (s->blk_near >= s->blk_matches - s->blk_matches / 16) {
+            s->adapt_mode = ADAPT_RLE;
+        }
+        s->adapt_blocks = 0;
+        return;
+    }
+
+    if (s->adapt_mode == ADAPT_HUFF) {
+        ratio = (uint32_t)(((uint64_t)s->blk_out << 8) / s->blk_in);
+        if (s->adapt_ratio != 0 && (ratio > s->adapt_ratio + ADAPT_DRIFT || ratio + ADAPT_DRIFT < s->adapt_ratio))
+            s->adapt_blocks = ADAPT_PROBE;
+        s->adapt_ratio = ratio;
+    } else if (covered < s->blk_in / 2) {
+        s->adapt_blocks = ADAPT_PROBE;
+    }
+
+    if (++s->adapt_blocks >= ADAPT_PROBE)
+        s->adapt_mode = ADAPT_LEVEL;
+}
+
+/* ===========================================================================
+ * For Z_ADAPTIVE, run the match finder chosen for the current block. The
+ * strategies return block_switch after each block they flush, letting the
+ * next block be compressed with another one. Only deflate_slow can leave
+ * something pending at that point, its lazy literal. None of them relies on
+ * the hash table being up to date, only on it pointing inside the window.
+ */
+Z_INTERNAL block_state deflate_adaptive(deflate_state *s, int flush) {
+    block_state bstate;
+    compress_func level_func = s->compress;
+
+    /* deflate_quick keeps its block open between calls. Only the generic
+     * deflate_fast hashes longer keys, see lm_set_level() */
+    if (level_func == deflate_quick)
+        level_func = s->hash_len == HASH_LEN ? functable.deflate_fast : deflate_fast;
+
+    do {
+        switch (s->adapt_mode) {
+        case ADAPT_RLE:
+            bstate = deflate_rle(s, flush);
+            break;
+        case ADAPT_HUFF:
+            bstate = deflate_huff(s, flush);
+            break;
+        default:
+            bstate = level_func(s, flush);
+            break;
+        }
+        if (bstate == block_switch) {
+            adapt_choose(s);
+            if (s->adapt_mode != ADAPT_LEVEL) {
+                /* Send the literal deflate_slow may have left pending and
+                 * have it start afresh when it is chosen again */
+                if (s->match_available) {
+                    zng_tr_tally_lit(s, s->window[s->strstart - 1]);
+                    s->match_available = 0;
+                }
+                s->prev_length = 0;
+            }
+        }
+    } while (bstate == block_switch);
+
+    return bstate;
+}
@@ -9,15 +9,56 @@
 #include "deflate_p.h"
 #include "functable.h"
 
+/* Below this many bytes the literal frequencies are counted one by one. */
+#define HUFF_HIST_MIN 64
+
+/* ===========================================================================
+ * Add the bytes of buf to the literal frequencies of the current block. Four
+ * sets of counters are used in turn, so that runs of the same byte do not
+ * serialize on one store-to-load dependency.
+ */
+static void huff_histogram(deflate_state *s, const unsigned char *buf, uint32_t len) {
+    uint32_t count[4][256];
+    uint32_t i;
+
+    if (len < HUFF_HIST_MIN) {
+        for (i = 0; i < len; i++)
+            s->dyn_ltree[buf[i]].Freq++;
+        return;
+    }
+
+    memset(count, 0, sizeof(count));
+    for (i = 0; i + 4 <= len; i += 4) {
+        count[0][buf[i]]++;
+        count[1][buf[i+1]]++;
+        count[2][buf[i+2]]++;
+        count[3][buf[i+3]]++;
+    }
+    for (; i < len; i++)
+        count[0][buf[i]]++;
+
+    for (i = 0; i < 256; i++)
+        s->dyn_ltree[i].Freq += (uint16_t)(count[0][i] + count[1][i] + count[2][i] + count[3][i]);
+}
+
 /* ===========================================================================
  * For Z_HUFFMAN_ONLY, do not look for matches.  Do not maintain a hash table.
  * (It will be regenerated if this run of deflate switches away from Huffman.)
+ * The literals are not tallied in sym_buf: their frequencies are counted
+ * straight from the window and the block is encoded from the window when it
+ * is flushed.
  */
 Z_INTERNAL block_state deflate_huff(deflate_state *s, int flush) {
-    int bflush = 0;         /* set if current block must be flushed */
+    uint32_t block_lits;    /* literals the current block can hold */
+    uint32_t len;
+
+    /* Same block size as when tallying, but never longer than what stays in
+     * the window until the block is flushed.
+     */
+    block_lits = MIN(s->sym_end / SYM_SIZE, MAX_DIST(s));
 
     for (;;) {
-        /* Make sure that we have a literal to write. */
+        /* Make sure that we have literals to write. */
         if (s->lookahead == 0) {
             fill_window(s);
             if (s->lookahead == 0) {
@@ -27,11 +68,13 @@ Z_INTERNAL block_state deflate_huff(deflate_state *s, int flush) {
             }
         }
 
-        /* Output a literal byte */
-        bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
-        s->lookahead--;
-        s->strstart++;
-        if (bflush)
+        /* Count as many literals as fit in the block */
+        len = MIN(s->lookahead, block_lits - s->sym_next / SYM_SIZE - s->direct_lits);
+        huff_histogram(s, s->window + s->strstart, len);
+        s->direct_lits += len;
+        s->lookahead -= len;
+        s->strstart += len;
+        if (s->sym_next / SYM_SIZE + s->direct_lits == block_lits)
             FLUSH_BLOCK(s, 0);
     }
     s->insert = 0;
@@ -39,7 +82,7 @@ Z_INTERNAL block_state deflate_huff(deflate_state *s, int flush) {
         FLUSH_BLOCK(s, 1);
         return finish_done;
     }
-    if (s->sym_next)
+    if (s->sym_next || s->direct_lits)
         FLUSH_BLOCK(s, 0);
     return block_done;
 }
@@ -60,9 +60,14 @@ extern const unsigned char Z_INTERNAL zng_dist_code[];
 
 static inline int zng_tr_tally_lit(deflate_state *s, unsigned char c) {
     /* c is the unmatched char */
+#ifdef LIT_MEM
+    s->d_buf[s->sym_next] = 0;
+    s->l_buf[s->sym_next++] = c;
+#else
     s->sym_buf[s->sym_next++] = 0;
     s->sym_buf[s->sym_next++] = 0;
     s->sym_buf[s->sym_next++] = c;
+#endif
     s->dyn_ltree[c].Freq++;
     Tracevv((stderr, "%c", c));
     Assert(c <= (STD_MAX_MATCH-STD_MIN_MATCH), "zng_tr_tally: bad literal");
@@ -72,9 +77,14 @@ static inline int zng_tr_tally_lit(deflate_state *s, unsigned char c) {
 static inline int zng_tr_tally_dist(deflate_state *s, uint32_t dist, uint32_t len) {
     /* dist: distance of matched string */
     /* len: match length-STD_MIN_MATCH */
+#ifdef LIT_MEM
+    s->d_buf[s->sym_next] = (uint16_t)dist;
+    s->l_buf[s->sym_next++] = (uint8_t)len;
+#else
     s->sym_buf[s->sym_next++] = (uint8_t)(dist);
     s->sym_buf[s->sym_next++] = (uint8_t)(dist >> 8);
     s->sym_buf[s->sym_next++] = (uint8_t)len;
+#endif
     s->matches++;
     dist--;
     Assert(dist < MAX_DIST(s) && (uint16_t)d_code(dist) < (uint16_t)D_CODES,
@@ -85,6 +95,31 @@ static inline int zng_tr_tally_dist(deflate_state *s, uint32_t dist, uint32_t le
     return (s->sym_next == s->sym_end);
 }
 
+/* Positions inserted in the hash table at the end of a run sent by the
+ * strategies' run fast path: the last position of the run itself and those
+ * whose strings reach into the bytes after it.
+ */
+#define RUN_TAIL_INSERT 4
+
+/* ===========================================================================
+ * Return whether the STD_MAX_MATCH bytes at strstart all repeat the byte before
+ * them, so that a maximum length match at distance one can be sent without
+ * searching the hash chains. The caller makes sure that strstart > 0 and that
+ * there are at least MIN_LOOKAHEAD bytes of lookahead.
+ */
+static inline int zng_max_run(deflate_state *s, uint32_t (*compare258)(const unsigned char *, const unsigned char *)) {
+    const unsigned char *scan = s->window + s->strstart;
+
+#ifdef UNALIGNED_OK
+    if (*(uint32_t *)(scan - 1) != *(uint32_t *)scan)
+        return 0;
+#else
+    if (scan[-1] != scan[0] || scan[0] != scan[1] || scan[1] != scan[2] || scan[2] != scan[3])
+        return 0;
+#endif
+    return compare258(scan, scan - 1) == STD_MAX_MATCH;
+}
+
 /* ===========================================================================
  * Flush the current block, with given end-of-file flag.
  * IN assertion: strstart is set to the end of the current match.
@@ -99,17 +134,17 @@ static inline int zng_tr_tally_dist(deflate_state *s, uint32_t dist, uint32_t le
     flush_pending(s->strm); \
 }
 
-/* Same but force premature exit if necessary. */
+/* Same but force premature exit if necessary, or return to deflate_adaptive()
+ * so that it can choose how to compress the next block. */
 #define FLUSH_BLOCK(s, last) { \
     FLUSH_BLOCK_ONLY(s, last); \
     if (s->strm->avail_out == 0) return (last) ? finish_started : need_more; \
+    if (s->strategy == Z_ADAPTIVE && !(last)) return block_switch; \
 }
 
 /* Maximum stored block length in deflate format (not including header). */
 #define MAX_STORED 65535
 
-/* Compression function. Returns the block state after the call. */
-typedef block_state (*compress_func) (deflate_state *s, int flush);
 /* Match function. Returns the longest match. */
 typedef uint32_t    (*match_func)    (deflate_state *const s, Pos cur_match);
 
@@ -9,21 +9,49 @@
 #include "deflate_p.h"
 #include "functable.h"
 
+/* Longest period looked for by Z_RLE. Distances up to 4 cost no extra bits and
+ * 5..8 one, so short periodic data (16/32/64-bit repeated values) is captured
+ * without any hash table.
+ */
+#define RLE_MAX_DIST 8
+
+/* Returns zero when none of distances 1..RLE_MAX_DIST can repeat the
+ * STD_MIN_MATCH bytes at scan. Three word compares test all eight distances at
+ * once, so literal-heavy input does not pay for eight separate probes.
+ * Requires RLE_MAX_DIST bytes of history before scan.
+ */
+static inline int rle_may_repeat(const unsigned char *scan) {
+#ifdef UNALIGNED64_OK
+    const uint64_t ones = 0x0101010101010101ULL, low7 = 0x7f7f7f7f7f7f7f7fULL;
+    uint64_t diff = (*(uint64_t *)(scan - 8) ^ (scan[0] * ones)) |
+                    (*(uint64_t *)(scan - 7) ^ (scan[1] * ones)) |
+                    (*(uint64_t *)(scan - 6) ^ (scan[2] * ones));
+    /* Sets the high bit of every zero byte in diff, one byte per distance */
+    return (~(((diff & low7) + low7) | diff | low7)) != 0;
+#else
+    Z_UNUSED(scan);
+    return 1;
+#endif
+}
+
 /* ===========================================================================
- * For Z_RLE, simply look for runs of bytes, generate matches only of distance
- * one.  Do not maintain a hash table.  (It will be regenerated if this run of
+ * For Z_RLE, look for runs of repeated bytes or of repeated patterns of up to
+ * RLE_MAX_DIST bytes, i.e. generate matches only of distance one to eight.
+ * Do not maintain a hash table.  (It will be regenerated if this run of
  * deflate switches away from Z_RLE.)
  */
 Z_INTERNAL block_state deflate_rle(deflate_state *s, int flush) {
     int bflush = 0;                 /* set if current block must be flushed */
-    unsigned int prev;              /* byte at distance one to match */
-    unsigned char *scan, *strend;   /* scan goes up to strend for length of run */
+    unsigned char *scan, *match;    /* current string and its candidate repeat */
+    unsigned int dist, max_dist;    /* candidate distance and its limit */
+    uint32_t len;
     uint32_t match_len = 0;
+    uint32_t match_dist = 0;
 
     for (;;) {
         /* Make sure that we always have enough lookahead, except
          * at the end of the input file. We need STD_MAX_MATCH bytes
-         * for the longest run, plus one for the unrolled loop.
+         * for the longest run.
          */
         if (s->lookahead <= STD_MAX_MATCH) {
             fill_window(s);
@@ -33,39 +61,47 @@ Z_INTERNAL block_state deflate_rle(deflate_state *s, int flush) {
                 break; /* flush the current block */
         }
 
-        /* See how many times the previous byte repeats */
+        /* Find the longest repetition at distances 1..RLE_MAX_DIST. The first
+         * STD_MIN_MATCH bytes are checked inline so that compare258, which
+         * scans 16 or 32 bytes per step on SIMD targets, only runs for real
+         * candidates. Ties go to the shorter, cheaper distance.
+         */
         if (s->lookahead >= STD_MIN_MATCH && s->strstart > 0) {
-            scan = s->window + s->strstart - 1;
-            prev = *scan;
-            if (prev == *++scan && prev == *++scan && prev == *++scan) {
-                strend = s->window + s->strstart + STD_MAX_MATCH;
-                do {
-                } while (prev == *++scan && prev == *++scan &&
-                         prev == *++scan && prev == *++scan &&
-                         prev == *++scan && prev == *++scan &&
-                         prev == *++scan && prev == *++scan &&
-                         scan < strend);
-                match_len = STD_MAX_MATCH - (unsigned int)(strend - scan);
-                match_len = MIN(match_len, s->lookahead);
+            scan = s->window + s->strstart;
+            max_dist = MIN(s->strstart, RLE_MAX_DIST);
+            if (max_dist < RLE_MAX_DIST || rle_may_repeat(scan)) {
+                for (dist = 1; dist <= max_dist; dist++) {
+                    match = scan - dist;
+                    if (scan[0] != match[0] || scan[1] != match[1] || scan[2] != match[2])
+                        continue;
+                    len = functable.compare258(scan, match);
+                    if (len > match_len) {
+                        match_len = len;
+                        match_dist = dist;
+                        if (len >= STD_MAX_MATCH)
+                            break;
+                    }
+                }
             }
-            Assert(scan <= s->window + s->window_size - 1, "wild scan");
+            match_len = MIN(match_len, s->lookahead);
+            Assert(scan + match_len <= s->window + s->window_size, "wild scan");
         }
 
         /* Emit match if have run of STD_MIN_MATCH or longer, else emit literal */
         if (match_len >= STD_MIN_MATCH) {
-            check_match(s, s->strstart, s->strstart - 1, match_len);
+            check_match(s, s->strstart, s->strstart - match_dist, match_len);
 
-            bflush = zng_tr_tally_dist(s, 1, match_len - STD_MIN_MATCH);
+            bflush = zng_tr_tally_dist(s, match_dist, match_len - STD_MIN_MATCH);
 
             s->lookahead -= match_len;
             s->strstart += match_len;
-            match_len = 0;
         } else {
             /* No match, output a literal byte */
             bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
             s->lookahead--;
             s->strstart++;
         }
+        match_len = 0;
         if (bflush)
             FLUSH_BLOCK(s, 0);
     }
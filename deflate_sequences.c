@@ -0,0 +1,116 @@
+/* deflate_sequences.c -- send the literals and matches of a parse supplied by
+ *                        the application, see zng_deflateSequences()
+ *
+ * Copyright (C) 1995-2013 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "deflate.h"
+#include "deflate_p.h"
+
+#ifndef ZLIB_COMPAT
+
+/* Stop at the current sequence, leaving it unsent, because it is not valid */
+#define SEQUENCE_ERROR(s, message) { \
+    s->strm->msg = (char *)(message); \
+    s->seq_error = 1; \
+    return need_more; \
+}
+
+/* Flush the current block and stop if the output is full. Unlike FLUSH_BLOCK,
+ * never return to deflate_adaptive(), which is not running. */
+#define FLUSH_SEQUENCE_BLOCK(s, last) { \
+    FLUSH_BLOCK_ONLY(s, last); \
+    if (s->strm->avail_out == 0) return (last) ? finish_started : need_more; \
+}
+
+/* ===========================================================================
+ * Tally the sequences left in s->seqs against the input in the window, then,
+ * unless flush is Z_NO_FLUSH, the input after them as literals. Nothing is
+ * inserted in the hash table, deflate() may only take over after a flush.
+ */
+Z_INTERNAL block_state deflate_sequences(deflate_state *s, int flush) {
+    zng_deflate_sequence *seq;
+    uint32_t max_dist, n;
+    int bflush;
+
+    for (;;) {
+        /* Level 0 stores the block from the window, end it before it slides
+         * out, which also keeps it below the 64K of a stored block */
+        if (s->level == 0 && (int)s->strstart - s->block_start >= (int)MAX_DIST(s))
+            FLUSH_SEQUENCE_BLOCK(s, 0);
+        if (s->lookahead < MIN_LOOKAHEAD)
+            fill_window(s);
+
+        if (s->seq_left == 0) {
+            /* The input after the last sequence may belong to the next ones */
+            if (flush == Z_NO_FLUSH)
+                return need_more;
+            if (s->lookahead == 0)
+                break;
+            bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
+            s->strstart++;
+            s->lookahead--;
+            if (bflush)
+                FLUSH_SEQUENCE_BLOCK(s, 0);
+            continue;
+        }
+
+        seq = s->seqs;
+        if (seq->lit_len != 0) {
+            if (s->lookahead == 0) {
+                if (flush == Z_NO_FLUSH)
+                    return need_more;
+                SEQUENCE_ERROR(s, "sequence past the end of the input");
+            }
+            bflush = 0;
+            for (n = MIN(seq->lit_len, s->lookahead); n != 0 && !bflush; n--) {
+                bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
+                s->strstart++;
+                s->lookahead--;
+                seq->lit_len--;
+            }
+            if (bflush)
+                FLUSH_SEQUENCE_BLOCK(s, 0);
+            continue;
+        }
+
+        bflush = 0;
+        if (seq->match_len != 0) {
+            if (seq->match_len < STD_MIN_MATCH || seq->match_len > STD_MAX_MATCH)
+                SEQUENCE_ERROR(s, "invalid sequence match length");
+            if (s->lookahead < seq->match_len) {
+                if (flush == Z_NO_FLUSH)
+                    return need_more;
+                SEQUENCE_ERROR(s, "sequence past the end of the input");
+            }
+            /* The window holds at least MAX_DIST bytes of history after sliding */
+            max_dist = MIN(s->strstart, MAX_DIST(s));
+            if (seq->dist == 0 || seq->dist > max_dist)
+                SEQUENCE_ERROR(s, "invalid sequence distance too far back");
+            if (memcmp(s->window + s->strstart, s->window + s->strstart - seq->dist, seq->match_len) != 0)
+                SEQUENCE_ERROR(s, "sequence does not match the input");
+
+            check_match(s, s->strstart, s->strstart - seq->dist, seq->match_len);
+            bflush = zng_tr_tally_dist(s, seq->dist, seq->match_len - STD_MIN_MATCH);
+            s->strstart += seq->match_len;
+            s->lookahead -= seq->match_len;
+        }
+        /* Done with the sequence before its block may be flushed */
+        s->seqs++;
+        s->seq_left--;
+        if (bflush)
+            FLUSH_SEQUENCE_BLOCK(s, 0);
+    }
+
+    s->insert = 0;
+    if (UNLIKELY(flush == Z_FINISH)) {
+        FLUSH_SEQUENCE_BLOCK(s, 1);
+        return finish_done;
+    }
+    if (s->sym_next)
+        FLUSH_SEQUENCE_BLOCK(s, 0);
+    return block_done;
+}
+#endif
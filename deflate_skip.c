@@ -0,0 +1,174 @@
+/* deflate_skip.c -- skip over incompressible input in the lazy strategies
+ *
+ * Copyright (C) 1995-2013 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "deflate.h"
+#include "deflate_p.h"
+#include "functable.h"
+
+/* Misses between two steps of the skip distance, which grows by one byte up to
+ * SKIP_MAX_STEP as the run of misses gets longer.
+ */
+#define SKIP_ACCEL_SHIFT 5
+#define SKIP_MAX_STEP    32
+
+/* Once this many positions in a row had no match the input is considered
+ * incompressible and is sent as stored blocks, each checked for whether the
+ * input has become compressible again.
+ */
+#define SKIP_STORED      1024
+
+/* Largest stored block sent by the skip, which takes all of the lookahead */
+#define SKIP_STORED_CHUNK MAX_STORED
+
+/* Lookahead needed to start sending stored blocks, 16K with the default window.
+ * deflateBound() allows for one block header per 16K of input.
+ */
+#define SKIP_STORED_MIN(s) ((s)->w_size / 2)
+
+/* Distance between the positions of a stored block that are hashed and
+ * checked for a repeat of earlier input */
+#define SKIP_STORED_HASH  8
+
+/* ===========================================================================
+ * Check that the bytes of buf are spread evenly enough over all 256 values
+ * for Huffman coding not to beat a stored block. The sum of the squared byte
+ * counts is about len + len^2 / 256 for random data and several times that
+ * for anything with a skewed distribution; allow one eighth above it.
+ */
+static int skip_flat(const unsigned char *buf, uint32_t len) {
+    uint32_t count[256];
+    uint64_t sum_sq = 0;
+    uint32_t i;
+
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < len; i++)
+        count[buf[i]]++;
+    for (i = 0; i < 256; i++)
+        sum_sq += (uint64_t)count[i] * count[i];
+
+    return sum_sq * 256 <= (uint64_t)len * len * 9 / 8 + (uint64_t)len * 256;
+}
+
+/* ===========================================================================
+ * Send up to SKIP_STORED_CHUNK bytes of lookahead as a stored block, after
+ * flushing what was tallied so far, unless their byte distribution shows that
+ * they would compress. In that case the run of misses is reset so that the
+ * caller goes back to searching every position. Every SKIP_STORED_HASH-th
+ * position of the block is hashed, so that repeats of it are found later on,
+ * and the block ends early at a hashed position that repeats earlier input,
+ * again resetting the run of misses. Returns 0 if the output is full.
+ */
+static int skip_stored(deflate_state *s) {
+    uint32_t len, pos, end;
+    Pos hash_head;
+
+    len = MIN(s->lookahead, SKIP_STORED_CHUNK);
+    if (!skip_flat(s->window + s->strstart, len)) {
+        s->match_misses = 0;
+        return 1;
+    }
+
+    if (s->sym_next || (int)s->strstart != s->block_start) {
+        FLUSH_BLOCK_ONLY(s, 0);
+        if (s->strm->avail_out == 0)
+            return 0;
+    }
+
+    /* The block is empty, so pending_buf is not shared with sym_buf */
+    len = MIN(len, (uint32_t)(s->pending_buf_size - s->pending - 8));
+    end = s->strstart + len;
+    for (pos = s->strstart; pos < end; pos += SKIP_STORED_HASH) {
+        hash_head = s->quick_insert_string(s, pos);
+        if (hash_head != 0 && hash_head < pos && pos - hash_head <= MAX_DIST(s) &&
+            memcmp(s->window + hash_head, s->window + pos, 4) == 0) {
+            len = pos - s->strstart;
+            s->match_misses = 0;
+            if (len == 0)
+                return 1;
+            break;
+        }
+    }
+
+    zng_tr_stored_block(s, (char *)s->window + s->strstart, len, 0);
+    s->strstart += len;
+    s->lookahead -= len;
+    s->block_start = (int)s->strstart;
+    flush_pending(s->strm);
+    return s->strm->avail_out != 0;
+}
+
+/* ===========================================================================
+ * Called by deflate_medium and deflate_slow after SKIP_TRIGGER positions in a
+ * row produced no match and with no lazy match pending, searching with the
+ * caller's longest_match. Only every step-th position is hashed and searched,
+ * the step growing with the run of misses as in LZ4, and the skipped bytes are
+ * sent as literals. After SKIP_STORED misses the input goes out as stored
+ * blocks, one after the other with the window refilled in between, until one
+ * of them finds that the input compresses again. Returns as
+ * soon as a match is found and emitted, leaving no match pending, or when the
+ * lookahead runs low. Returns 0 if the output is full and the caller has to
+ * return need_more.
+ */
+Z_INTERNAL int deflate_skip(deflate_state *s, uint32_t (*longest_match)(deflate_state *const s, Pos cur_match)) {
+    Pos hash_head;
+    int64_t dist;
+    uint32_t match_len, step;
+    int bflush;
+
+    s->prev_length = 0;
+
+    while (s->lookahead >= MIN_LOOKAHEAD) {
+        hash_head = s->quick_insert_string(s, s->strstart);
+        dist = (int64_t)s->strstart - hash_head;
+
+        if (dist <= MAX_DIST(s) && dist > 0 && hash_head != 0) {
+            match_len = longest_match(s, hash_head);
+            if (match_len >= WANT_MIN_MATCH) {
+                check_match(s, s->strstart, s->match_start, match_len);
+
+                bflush = zng_tr_tally_dist(s, s->strstart - s->match_start, match_len - STD_MIN_MATCH);
+
+                s->match_misses = 0;
+                s->lookahead -= match_len;
+                s->insert_string(s, s->strstart + 1, match_len - 1);
+                s->strstart += match_len;
+                if (UNLIKELY(bflush)) {
+                    FLUSH_BLOCK_ONLY(s, 0);
+                    if (s->strm->avail_out == 0)
+                        return 0;
+                }
+                return 1;
+            }
+        }
+
+        /* No match, send literals up to the next probe */
+        step = 1 + ((s->match_misses - SKIP_TRIGGER) >> SKIP_ACCEL_SHIFT);
+        step = MIN(step, SKIP_MAX_STEP);
+        s->match_misses++;
+        do {
+            bflush = zng_tr_tally_lit(s, s->window[s->strstart]);
+            s->lookahead--;
+            s->strstart++;
+            if (UNLIKELY(bflush)) {
+                FLUSH_BLOCK_ONLY(s, 0);
+                if (s->strm->avail_out == 0)
+                    return 0;
+            }
+        } while (--step);
+
+        /* No literals between the blocks, which would each take a block of their own */
+        while (s->match_misses >= SKIP_STORED && s->lookahead >= SKIP_STORED_MIN(s)) {
+            if (!skip_stored(s))
+                return 0;
+            if (s->match_misses == 0)
+                return 1;
+            if (s->lookahead < MIN_LOOKAHEAD)
+                fill_window(s);
+        }
+    }
+    return 1;
+}
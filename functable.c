@@ -66,6 +66,12 @@ extern uint32_t adler32_avx2(uint32_t adler, const unsigned char *buf, size_t le
 extern uint32_t adler32_power8(uint32_t adler, const unsigned char* buf, size_t len);
 #endif
 
+/* adler32_x4 */
+extern void adler32_x4_c(uint32_t sum[4], const unsigned char *buf[4], size_t len);
+#ifdef X86_SSSE3_ADLER32
+extern void adler32_x4_ssse3(uint32_t sum[4], const unsigned char *buf[4], size_t len);
+#endif
+
 /* memory chunking */
 extern uint32_t chunksize_c(void);
 extern uint8_t* chunkcopy_c(uint8_t *out, uint8_t const *from, unsigned len);
@@ -116,6 +122,15 @@ extern uint32_t crc32_acle(uint32_t, const unsigned char *, uint64_t);
 extern uint32_t s390_crc32_vx(uint32_t, const unsigned char *, uint64_t);
 #endif
 
+/* crc32_x4 */
+extern void crc32_x4_c(uint32_t sum[4], const unsigned char *buf[4], size_t len);
+#ifdef X86_PCLMULQDQ_CRC
+extern void crc32_x4_pclmulqdq(uint32_t sum[4], const unsigned char *buf[4], size_t len);
+#endif
+#ifdef ARM_ACLE_CRC_HASH
+extern void crc32_x4_acle(uint32_t sum[4], const unsigned char *buf[4], size_t len);
+#endif
+
 /* compare258 */
 extern uint32_t compare258_c(const unsigned char *src0, const unsigned char *src1);
 #ifdef UNALIGNED_OK
@@ -148,6 +163,21 @@ extern uint32_t longest_match_unaligned_avx2(deflate_state *const s, Pos cur_mat
 #endif
 #endif
 
+/* deflate strategies */
+extern block_state deflate_fast(deflate_state *s, int flush);
+extern block_state deflate_medium(deflate_state *s, int flush);
+extern block_state deflate_slow(deflate_state *s, int flush);
+#ifdef X86_SSE42_DEFLATE
+extern block_state deflate_fast_sse4(deflate_state *s, int flush);
+extern block_state deflate_medium_sse4(deflate_state *s, int flush);
+extern block_state deflate_slow_sse4(deflate_state *s, int flush);
+#endif
+#ifdef X86_AVX2_DEFLATE
+extern block_state deflate_fast_avx2(deflate_state *s, int flush);
+extern block_state deflate_medium_avx2(deflate_state *s, int flush);
+extern block_state deflate_slow_avx2(deflate_state *s, int flush);
+#endif
+
 /* longest_match_slow */
 extern uint32_t longest_match_slow_c(deflate_state *const s, Pos cur_match);
 #ifdef UNALIGNED_OK
@@ -164,13 +194,36 @@ extern uint32_t longest_match_slow_unaligned_avx2(deflate_state *const s, Pos cu
 #endif
 #endif
 
-Z_INTERNAL Z_TLS struct functable_s functable;
+/* The table is shared by all threads.  Until init_functable() has run once
+ * every entry points at a stub that runs it and forwards the call, afterwards
+ * the entries only ever hold the final selection so readers need no locking. */
+#define FUNCTABLE_NONE      0
+#define FUNCTABLE_BUSY      1
+#define FUNCTABLE_READY     2
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define FUNCTABLE_LOAD_STATE(p)           __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#  define FUNCTABLE_CLAIM_STATE(p)          __sync_bool_compare_and_swap(p, FUNCTABLE_NONE, FUNCTABLE_BUSY)
+#  define FUNCTABLE_STORE_STATE(p, v)       __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#  define FUNCTABLE_ASSIGN(ft, name)        __atomic_store_n(&functable.name, ft.name, __ATOMIC_RELAXED)
+#elif defined(_MSC_VER)
+#  include <intrin.h>
+#  define FUNCTABLE_LOAD_STATE(p)           _InterlockedCompareExchange(p, FUNCTABLE_NONE, FUNCTABLE_NONE)
+#  define FUNCTABLE_CLAIM_STATE(p)          (_InterlockedCompareExchange(p, FUNCTABLE_BUSY, FUNCTABLE_NONE) == FUNCTABLE_NONE)
+#  define FUNCTABLE_STORE_STATE(p, v)       _InterlockedExchange(p, v)
+#  define FUNCTABLE_ASSIGN(ft, name)        functable.name = ft.name
+#else
+#  define FUNCTABLE_LOAD_STATE(p)           (*(p))
+#  define FUNCTABLE_CLAIM_STATE(p)          (*(p) == FUNCTABLE_NONE ? (*(p) = FUNCTABLE_BUSY, 1) : 0)
+#  define FUNCTABLE_STORE_STATE(p, v)       *(p) = (v)
+#  define FUNCTABLE_ASSIGN(ft, name)        functable.name = ft.name
+#endif
+
+static volatile long functable_state = FUNCTABLE_NONE;
+
+static void init_functable(void) {
+    struct functable_s ft;
 
-Z_INTERNAL void cpu_check_features(void)
-{
-    static int features_checked = 0;
-    if (features_checked)
-        return;
 #if defined(X86_FEATURES)
     x86_check_features();
 #elif defined(ARM_FEATURES)
@@ -180,385 +233,511 @@ Z_INTERNAL void cpu_check_features(void)
 #elif defined(S390_FEATURES)
     s390_check_features();
 #endif
-    features_checked = 1;
-}
-
-/* stub functions */
-Z_INTERNAL uint32_t update_hash_stub(deflate_state *const s, uint32_t h, uint32_t val) {
-    // Initialize default
 
-    functable.update_hash = &update_hash_c;
-    cpu_check_features();
+    /* update_hash */
+    ft.update_hash = &update_hash_c;
 
 #ifdef X86_SSE42_CRC_HASH
     if (x86_cpu_has_sse42)
-        functable.update_hash = &update_hash_sse4;
+        ft.update_hash = &update_hash_sse4;
 #elif defined(ARM_ACLE_CRC_HASH)
     if (arm_cpu_has_crc32)
-        functable.update_hash = &update_hash_acle;
+        ft.update_hash = &update_hash_acle;
 #endif
 
-    return functable.update_hash(s, h, val);
-}
-
-Z_INTERNAL void insert_string_stub(deflate_state *const s, uint32_t str, uint32_t count) {
-    // Initialize default
-
-    functable.insert_string = &insert_string_c;
-    cpu_check_features();
+    /* insert_string */
+    ft.insert_string = &insert_string_c;
 
 #ifdef X86_SSE42_CRC_HASH
     if (x86_cpu_has_sse42)
-        functable.insert_string = &insert_string_sse4;
+        ft.insert_string = &insert_string_sse4;
 #elif defined(ARM_ACLE_CRC_HASH)
     if (arm_cpu_has_crc32)
-        functable.insert_string = &insert_string_acle;
+        ft.insert_string = &insert_string_acle;
 #endif
 
-    functable.insert_string(s, str, count);
-}
-
-Z_INTERNAL Pos quick_insert_string_stub(deflate_state *const s, const uint32_t str) {
-    functable.quick_insert_string = &quick_insert_string_c;
+    /* quick_insert_string */
+    ft.quick_insert_string = &quick_insert_string_c;
 
 #ifdef X86_SSE42_CRC_HASH
     if (x86_cpu_has_sse42)
-        functable.quick_insert_string = &quick_insert_string_sse4;
+        ft.quick_insert_string = &quick_insert_string_sse4;
 #elif defined(ARM_ACLE_CRC_HASH)
     if (arm_cpu_has_crc32)
-        functable.quick_insert_string = &quick_insert_string_acle;
+        ft.quick_insert_string = &quick_insert_string_acle;
 #endif
 
-    return functable.quick_insert_string(s, str);
-}
+    /* adler32 */
+    ft.adler32 = &adler32_c;
+
+#ifdef ARM_NEON_ADLER32
+#  ifndef ARM_NOCHECK_NEON
+    if (arm_cpu_has_neon)
+#  endif
+        ft.adler32 = &adler32_neon;
+#endif
+#ifdef X86_SSSE3_ADLER32
+    if (x86_cpu_has_ssse3)
+        ft.adler32 = &adler32_ssse3;
+#endif
+#ifdef X86_AVX2_ADLER32
+    if (x86_cpu_has_avx2)
+        ft.adler32 = &adler32_avx2;
+#endif
+#ifdef POWER8_VSX_ADLER32
+    if (power_cpu_has_arch_2_07)
+        ft.adler32 = &adler32_power8;
+#endif
 
-Z_INTERNAL void slide_hash_stub(deflate_state *s) {
+    /* crc32 */
+    Assert(sizeof(uint64_t) >= sizeof(size_t),
+           "crc32_z takes size_t but internally we have a uint64_t len");
+    ft.crc32 = sizeof(void *) == sizeof(ptrdiff_t) ? &crc32_braid : &crc32_generic;
+#if BYTE_ORDER == LITTLE_ENDIAN && defined(ARM_ACLE_CRC_HASH)
+    if (arm_cpu_has_crc32)
+        ft.crc32 = &crc32_acle;
+#elif BYTE_ORDER == BIG_ENDIAN && defined(S390_CRC32_VX)
+    if (s390_cpu_has_vx)
+        ft.crc32 = &s390_crc32_vx;
+#endif
+
+    /* adler32_x4 */
+    ft.adler32_x4 = &adler32_x4_c;
+
+#ifdef X86_SSSE3_ADLER32
+    if (x86_cpu_has_ssse3)
+        ft.adler32_x4 = &adler32_x4_ssse3;
+#endif
+
+    /* crc32_x4 */
+    ft.crc32_x4 = &crc32_x4_c;
+
+#ifdef X86_PCLMULQDQ_CRC
+    if (x86_cpu_has_pclmulqdq)
+        ft.crc32_x4 = &crc32_x4_pclmulqdq;
+#endif
+#if BYTE_ORDER == LITTLE_ENDIAN && defined(ARM_ACLE_CRC_HASH)
+    if (arm_cpu_has_crc32)
+        ft.crc32_x4 = &crc32_x4_acle;
+#endif
 
-    functable.slide_hash = &slide_hash_c;
-    cpu_check_features();
+    /* slide_hash */
+    ft.slide_hash = &slide_hash_c;
 
 #ifdef X86_SSE2
 #  if !defined(__x86_64__) && !defined(_M_X64) && !defined(X86_NOCHECK_SSE2)
     if (x86_cpu_has_sse2)
 #  endif
-        functable.slide_hash = &slide_hash_sse2;
+        ft.slide_hash = &slide_hash_sse2;
 #elif defined(ARM_NEON_SLIDEHASH)
 #  ifndef ARM_NOCHECK_NEON
     if (arm_cpu_has_neon)
 #  endif
-        functable.slide_hash = &slide_hash_neon;
+        ft.slide_hash = &slide_hash_neon;
 #endif
 #ifdef X86_AVX2
     if (x86_cpu_has_avx2)
-        functable.slide_hash = &slide_hash_avx2;
+        ft.slide_hash = &slide_hash_avx2;
 #endif
 #ifdef POWER8_VSX_SLIDEHASH
     if (power_cpu_has_arch_2_07)
-        functable.slide_hash = &slide_hash_power8;
+        ft.slide_hash = &slide_hash_power8;
 #endif
 
-    functable.slide_hash(s);
-}
+    /* compare258 */
+    ft.compare258 = &compare258_c;
 
-Z_INTERNAL uint32_t adler32_stub(uint32_t adler, const unsigned char *buf, size_t len) {
-    // Initialize default
-    functable.adler32 = &adler32_c;
-    cpu_check_features();
-
-#ifdef ARM_NEON_ADLER32
-#  ifndef ARM_NOCHECK_NEON
-    if (arm_cpu_has_neon)
+#ifdef UNALIGNED_OK
+#  if defined(UNALIGNED64_OK) && defined(HAVE_BUILTIN_CTZLL)
+    ft.compare258 = &compare258_unaligned_64;
+#  elif defined(HAVE_BUILTIN_CTZ)
+    ft.compare258 = &compare258_unaligned_32;
+#  else
+    ft.compare258 = &compare258_unaligned_16;
 #  endif
-        functable.adler32 = &adler32_neon;
-#endif
-#ifdef X86_SSSE3_ADLER32
-    if (x86_cpu_has_ssse3)
-        functable.adler32 = &adler32_ssse3;
-#endif
-#ifdef X86_AVX2_ADLER32
+#  ifdef X86_SSE42_CMP_STR
+    if (x86_cpu_has_sse42)
+        ft.compare258 = &compare258_unaligned_sse4;
+#  endif
+#  if defined(X86_AVX2) && defined(HAVE_BUILTIN_CTZ)
     if (x86_cpu_has_avx2)
-        functable.adler32 = &adler32_avx2;
+        ft.compare258 = &compare258_unaligned_avx2;
+#  endif
 #endif
-#ifdef POWER8_VSX_ADLER32
-    if (power_cpu_has_arch_2_07)
-        functable.adler32 = &adler32_power8;
+
+    /* longest_match */
+    ft.longest_match = &longest_match_c;
+
+#ifdef UNALIGNED_OK
+#  if defined(UNALIGNED64_OK) && defined(HAVE_BUILTIN_CTZLL)
+    ft.longest_match = &longest_match_unaligned_64;
+#  elif defined(HAVE_BUILTIN_CTZ)
+    ft.longest_match = &longest_match_unaligned_32;
+#  else
+    ft.longest_match = &longest_match_unaligned_16;
+#  endif
+#  ifdef X86_SSE42_CMP_STR
+    if (x86_cpu_has_sse42)
+        ft.longest_match = &longest_match_unaligned_sse4;
+#  endif
+#  if defined(X86_AVX2) && defined(HAVE_BUILTIN_CTZ)
+    if (x86_cpu_has_avx2)
+        ft.longest_match = &longest_match_unaligned_avx2;
+#  endif
 #endif
 
-    return functable.adler32(adler, buf, len);
-}
+    /* longest_match_slow */
+    ft.longest_match_slow = &longest_match_slow_c;
 
-Z_INTERNAL uint32_t chunksize_stub(void) {
-    // Initialize default
-    functable.chunksize = &chunksize_c;
-    cpu_check_features();
+#ifdef UNALIGNED_OK
+#  if defined(UNALIGNED64_OK) && defined(HAVE_BUILTIN_CTZLL)
+    ft.longest_match_slow = &longest_match_slow_unaligned_64;
+#  elif defined(HAVE_BUILTIN_CTZ)
+    ft.longest_match_slow = &longest_match_slow_unaligned_32;
+#  else
+    ft.longest_match_slow = &longest_match_slow_unaligned_16;
+#  endif
+#  ifdef X86_SSE42_CMP_STR
+    if (x86_cpu_has_sse42)
+        ft.longest_match_slow = &longest_match_slow_unaligned_sse4;
+#  endif
+#  if defined(X86_AVX2) && defined(HAVE_BUILTIN_CTZ)
+    if (x86_cpu_has_avx2)
+        ft.longest_match_slow = &longest_match_slow_unaligned_avx2;
+#  endif
+#endif
+
+    /* chunksize */
+    ft.chunksize = &chunksize_c;
 
 #ifdef X86_SSE2_CHUNKSET
 # if !defined(__x86_64__) && !defined(_M_X64) && !defined(X86_NOCHECK_SSE2)
     if (x86_cpu_has_sse2)
 # endif
-        functable.chunksize = &chunksize_sse2;
+        ft.chunksize = &chunksize_sse2;
 #endif
 #ifdef X86_AVX_CHUNKSET
     if (x86_cpu_has_avx2)
-        functable.chunksize = &chunksize_avx;
+        ft.chunksize = &chunksize_avx;
 #endif
 #ifdef ARM_NEON_CHUNKSET
     if (arm_cpu_has_neon)
-        functable.chunksize = &chunksize_neon;
+        ft.chunksize = &chunksize_neon;
 #endif
 #ifdef POWER8_VSX_CHUNKSET
     if (power_cpu_has_arch_2_07)
-        functable.chunksize = &chunksize_power8;
+        ft.chunksize = &chunksize_power8;
 #endif
 
-    return functable.chunksize();
-}
-
-Z_INTERNAL uint8_t* chunkcopy_stub(uint8_t *out, uint8_t const *from, unsigned len) {
-    // Initialize default
-    functable.chunkcopy = &chunkcopy_c;
+    /* chunkcopy */
+    ft.chunkcopy = &chunkcopy_c;
 
 #ifdef X86_SSE2_CHUNKSET
 # if !defined(__x86_64__) && !defined(_M_X64) && !defined(X86_NOCHECK_SSE2)
     if (x86_cpu_has_sse2)
 # endif
-        functable.chunkcopy = &chunkcopy_sse2;
+        ft.chunkcopy = &chunkcopy_sse2;
 #endif
 #ifdef X86_AVX_CHUNKSET
     if (x86_cpu_has_avx2)
-        functable.chunkcopy = &chunkcopy_avx;
+        ft.chunkcopy = &chunkcopy_avx;
 #endif
 #ifdef ARM_NEON_CHUNKSET
     if (arm_cpu_has_neon)
-        functable.chunkcopy = &chunkcopy_neon;
+        ft.chunkcopy = &chunkcopy_neon;
 #endif
 #ifdef POWER8_VSX_CHUNKSET
     if (power_cpu_has_arch_2_07)
-        functable.chunkcopy = &chunkcopy_power8;
+        ft.chunkcopy = &chunkcopy_power8;
 #endif
 
-    return functable.chunkcopy(out, from, len);
-}
-
-Z_INTERNAL uint8_t* chunkcopy_safe_stub(uint8_t *out, uint8_t const *from, unsigned len, uint8_t *safe) {
-    // Initialize default
-    functable.chunkcopy_safe = &chunkcopy_safe_c;
+    /* chunkcopy_safe */
+    ft.chunkcopy_safe = &chunkcopy_safe_c;
 
 #ifdef X86_SSE2_CHUNKSET
 # if !defined(__x86_64__) && !defined(_M_X64) && !defined(X86_NOCHECK_SSE2)
     if (x86_cpu_has_sse2)
 # endif
-        functable.chunkcopy_safe = &chunkcopy_safe_sse2;
+        ft.chunkcopy_safe = &chunkcopy_safe_sse2;
 #endif
 #ifdef X86_AVX_CHUNKSET
     if (x86_cpu_has_avx2)
-        functable.chunkcopy_safe = &chunkcopy_safe_avx;
+        ft.chunkcopy_safe = &chunkcopy_safe_avx;
 #endif
 #ifdef ARM_NEON_CHUNKSET
     if (arm_cpu_has_neon)
-        functable.chunkcopy_safe = &chunkcopy_safe_neon;
+        ft.chunkcopy_safe = &chunkcopy_safe_neon;
 #endif
 #ifdef POWER8_VSX_CHUNKSET
     if (power_cpu_has_arch_2_07)
-        functable.chunkcopy_safe = &chunkcopy_safe_power8;
+        ft.chunkcopy_safe = &chunkcopy_safe_power8;
 #endif
 
-    return functable.chunkcopy_safe(out, from, len, safe);
-}
-
-Z_INTERNAL uint8_t* chunkunroll_stub(uint8_t *out, unsigned *dist, unsigned *len) {
-    // Initialize default
-    functable.chunkunroll = &chunkunroll_c;
+    /* chunkunroll */
+    ft.chunkunroll = &chunkunroll_c;
 
 #ifdef X86_SSE2_CHUNKSET
 # if !defined(__x86_64__) && !defined(_M_X64) && !defined(X86_NOCHECK_SSE2)
     if (x86_cpu_has_sse2)
 # endif
-        functable.chunkunroll = &chunkunroll_sse2;
+        ft.chunkunroll = &chunkunroll_sse2;
 #endif
 #ifdef X86_AVX_CHUNKSET
     if (x86_cpu_has_avx2)
-        functable.chunkunroll = &chunkunroll_avx;
+        ft.chunkunroll = &chunkunroll_avx;
 #endif
 #ifdef ARM_NEON_CHUNKSET
     if (arm_cpu_has_neon)
-        functable.chunkunroll = &chunkunroll_neon;
+        ft.chunkunroll = &chunkunroll_neon;
 #endif
 #ifdef POWER8_VSX_CHUNKSET
     if (power_cpu_has_arch_2_07)
-        functable.chunkunroll = &chunkunroll_power8;
+        ft.chunkunroll = &chunkunroll_power8;
 #endif
 
-    return functable.chunkunroll(out, dist, len);
-}
-
-Z_INTERNAL uint8_t* chunkmemset_stub(uint8_t *out, unsigned dist, unsigned len) {
-    // Initialize default
-    functable.chunkmemset = &chunkmemset_c;
+    /* chunkmemset */
+    ft.chunkmemset = &chunkmemset_c;
 
 #ifdef X86_SSE2_CHUNKSET
 # if !defined(__x86_64__) && !defined(_M_X64) && !defined(X86_NOCHECK_SSE2)
     if (x86_cpu_has_sse2)
 # endif
-        functable.chunkmemset = &chunkmemset_sse2;
+        ft.chunkmemset = &chunkmemset_sse2;
 #endif
 #ifdef X86_AVX_CHUNKSET
     if (x86_cpu_has_avx2)
-        functable.chunkmemset = &chunkmemset_avx;
+        ft.chunkmemset = &chunkmemset_avx;
 #endif
 #ifdef ARM_NEON_CHUNKSET
     if (arm_cpu_has_neon)
-        functable.chunkmemset = &chunkmemset_neon;
+        ft.chunkmemset = &chunkmemset_neon;
 #endif
 #ifdef POWER8_VSX_CHUNKSET
     if (power_cpu_has_arch_2_07)
-        functable.chunkmemset = &chunkmemset_power8;
+        ft.chunkmemset = &chunkmemset_power8;
 #endif
 
-
-    return functable.chunkmemset(out, dist, len);
-}
-
-Z_INTERNAL uint8_t* chunkmemset_safe_stub(uint8_t *out, unsigned dist, unsigned len, unsigned left) {
-    // Initialize default
-    functable.chunkmemset_safe = &chunkmemset_safe_c;
+    /* chunkmemset_safe */
+    ft.chunkmemset_safe = &chunkmemset_safe_c;
 
 #ifdef X86_SSE2_CHUNKSET
 # if !defined(__x86_64__) && !defined(_M_X64) && !defined(X86_NOCHECK_SSE2)
     if (x86_cpu_has_sse2)
 # endif
-        functable.chunkmemset_safe = &chunkmemset_safe_sse2;
+        ft.chunkmemset_safe = &chunkmemset_safe_sse2;
 #endif
 #ifdef X86_AVX_CHUNKSET
     if (x86_cpu_has_avx2)
-        functable.chunkmemset_safe = &chunkmemset_safe_avx;
+        ft.chunkmemset_safe = &chunkmemset_safe_avx;
 #endif
 #ifdef ARM_NEON_CHUNKSET
     if (arm_cpu_has_neon)
-        functable.chunkmemset_safe = &chunkmemset_safe_neon;
+        ft.chunkmemset_safe = &chunkmemset_safe_neon;
 #endif
 #ifdef POWER8_VSX_CHUNKSET
     if (power_cpu_has_arch_2_07)
-        functable.chunkmemset_safe = &chunkmemset_safe_power8;
+        ft.chunkmemset_safe = &chunkmemset_safe_power8;
 #endif
 
-    return functable.chunkmemset_safe(out, dist, len, left);
-}
-
-Z_INTERNAL uint32_t crc32_stub(uint32_t crc, const unsigned char *buf, uint64_t len) {
-    int32_t use_byfour = sizeof(void *) == sizeof(ptrdiff_t);
-
-    Assert(sizeof(uint64_t) >= sizeof(size_t),
-           "crc32_z takes size_t but internally we have a uint64_t len");
-    /* return a function pointer for optimized arches here after a capability test */
-
-    cpu_check_features();
+    /* deflate strategies, the leaf functions of each tier match the choices above */
+    ft.deflate_fast = &deflate_fast;
+#ifndef NO_MEDIUM_STRATEGY
+    ft.deflate_medium = &deflate_medium;
+#endif
+    ft.deflate_slow = &deflate_slow;
 
-    if (use_byfour) {
-#if BYTE_ORDER == LITTLE_ENDIAN
-        functable.crc32 = crc32_little;
-#  if defined(ARM_ACLE_CRC_HASH)
-        if (arm_cpu_has_crc32)
-            functable.crc32 = crc32_acle;
+#ifdef X86_SSE42_DEFLATE
+    if (x86_cpu_has_sse42) {
+        ft.deflate_fast = &deflate_fast_sse4;
+#  ifndef NO_MEDIUM_STRATEGY
+        ft.deflate_medium = &deflate_medium_sse4;
 #  endif
-#elif BYTE_ORDER == BIG_ENDIAN
-        functable.crc32 = crc32_big;
-#  if defined(S390_CRC32_VX)
-        if (s390_cpu_has_vx)
-            functable.crc32 = s390_crc32_vx;
+        ft.deflate_slow = &deflate_slow_sse4;
+    }
+#endif
+#ifdef X86_AVX2_DEFLATE
+    if (x86_cpu_has_sse42 && x86_cpu_has_avx2) {
+        ft.deflate_fast = &deflate_fast_avx2;
+#  ifndef NO_MEDIUM_STRATEGY
+        ft.deflate_medium = &deflate_medium_avx2;
 #  endif
-#else
-#  error No endian defined
+        ft.deflate_slow = &deflate_slow_avx2;
+    }
 #endif
-    } else {
-        functable.crc32 = crc32_generic;
+
+    FUNCTABLE_ASSIGN(ft, update_hash);
+    FUNCTABLE_ASSIGN(ft, insert_string);
+    FUNCTABLE_ASSIGN(ft, quick_insert_string);
+    FUNCTABLE_ASSIGN(ft, adler32);
+    FUNCTABLE_ASSIGN(ft, crc32);
+    FUNCTABLE_ASSIGN(ft, adler32_x4);
+    FUNCTABLE_ASSIGN(ft, crc32_x4);
+    FUNCTABLE_ASSIGN(ft, slide_hash);
+    FUNCTABLE_ASSIGN(ft, compare258);
+    FUNCTABLE_ASSIGN(ft, longest_match);
+    FUNCTABLE_ASSIGN(ft, longest_match_slow);
+    FUNCTABLE_ASSIGN(ft, chunksize);
+    FUNCTABLE_ASSIGN(ft, chunkcopy);
+    FUNCTABLE_ASSIGN(ft, chunkcopy_safe);
+    FUNCTABLE_ASSIGN(ft, chunkunroll);
+    FUNCTABLE_ASSIGN(ft, chunkmemset);
+    FUNCTABLE_ASSIGN(ft, chunkmemset_safe);
+    FUNCTABLE_ASSIGN(ft, deflate_fast);
+#ifndef NO_MEDIUM_STRATEGY
+    FUNCTABLE_ASSIGN(ft, deflate_medium);
+#endif
+    FUNCTABLE_ASSIGN(ft, deflate_slow);
+}
+
+Z_INTERNAL void functable_init(void) {
+    if (LIKELY(FUNCTABLE_LOAD_STATE(&functable_state) == FUNCTABLE_READY))
+        return;
+    if (FUNCTABLE_CLAIM_STATE(&functable_state)) {
+        init_functable();
+        FUNCTABLE_STORE_STATE(&functable_state, FUNCTABLE_READY);
+        return;
     }
+    /* Another thread is filling in the table, which only takes a few cpuid calls */
+    while (FUNCTABLE_LOAD_STATE(&functable_state) != FUNCTABLE_READY)
+        ;
+}
+
+/* stub functions */
+static uint32_t update_hash_stub(deflate_state *const s, uint32_t h, uint32_t val) {
+    functable_init();
+    return functable.update_hash(s, h, val);
+}
+
+static void insert_string_stub(deflate_state *const s, uint32_t str, uint32_t count) {
+    functable_init();
+    functable.insert_string(s, str, count);
+}
+
+static Pos quick_insert_string_stub(deflate_state *const s, const uint32_t str) {
+    functable_init();
+    return functable.quick_insert_string(s, str);
+}
+
+static uint32_t adler32_stub(uint32_t adler, const unsigned char *buf, size_t len) {
+    functable_init();
+    return functable.adler32(adler, buf, len);
+}
 
+static uint32_t crc32_stub(uint32_t crc, const unsigned char *buf, uint64_t len) {
+    functable_init();
     return functable.crc32(crc, buf, len);
 }
 
-Z_INTERNAL uint32_t compare258_stub(const unsigned char *src0, const unsigned char *src1) {
+static void adler32_x4_stub(uint32_t sum[4], const unsigned char *buf[4], size_t len) {
+    functable_init();
+    functable.adler32_x4(sum, buf, len);
+}
 
-    functable.compare258 = &compare258_c;
+static void crc32_x4_stub(uint32_t sum[4], const unsigned char *buf[4], size_t len) {
+    functable_init();
+    functable.crc32_x4(sum, buf, len);
+}
 
-#ifdef UNALIGNED_OK
-#  if defined(UNALIGNED64_OK) && defined(HAVE_BUILTIN_CTZLL)
-    functable.compare258 = &compare258_unaligned_64;
-#  elif defined(HAVE_BUILTIN_CTZ)
-    functable.compare258 = &compare258_unaligned_32;
-#  else
-    functable.compare258 = &compare258_unaligned_16;
-#  endif
-#  ifdef X86_SSE42_CMP_STR
-    if (x86_cpu_has_sse42)
-        functable.compare258 = &compare258_unaligned_sse4;
-#  endif
-#  if defined(X86_AVX2) && defined(HAVE_BUILTIN_CTZ)
-    if (x86_cpu_has_avx2)
-        functable.compare258 = &compare258_unaligned_avx2;
-#  endif
-#endif
+static void slide_hash_stub(deflate_state *s) {
+    functable_init();
+    functable.slide_hash(s);
+}
 
+static uint32_t compare258_stub(const unsigned char *src0, const unsigned char *src1) {
+    functable_init();
     return functable.compare258(src0, src1);
 }
 
-Z_INTERNAL uint32_t longest_match_stub(deflate_state *const s, Pos cur_match) {
+static uint32_t longest_match_stub(deflate_state *const s, Pos cur_match) {
+    functable_init();
+    return functable.longest_match(s, cur_match);
+}
 
-    functable.longest_match = &longest_match_c;
+static uint32_t longest_match_slow_stub(deflate_state *const s, Pos cur_match) {
+    functable_init();
+    return functable.longest_match_slow(s, cur_match);
+}
 
-#ifdef UNALIGNED_OK
-#  if defined(UNALIGNED64_OK) && defined(HAVE_BUILTIN_CTZLL)
-    functable.longest_match = &longest_match_unaligned_64;
-#  elif defined(HAVE_BUILTIN_CTZ)
-    functable.longest_match = &longest_match_unaligned_32;
-#  else
-    functable.longest_match = &longest_match_unaligned_16;
-#  endif
-#  ifdef X86_SSE42_CMP_STR
-    if (x86_cpu_has_sse42)
-        functable.longest_match = &longest_match_unaligned_sse4;
-#  endif
-#  if defined(X86_AVX2) && defined(HAVE_BUILTIN_CTZ)
-    if (x86_cpu_has_avx2)
-        functable.longest_match = &longest_match_unaligned_avx2;
-#  endif
-#endif
+static uint32_t chunksize_stub(void) {
+    functable_init();
+    return functable.chunksize();
+}
 
-    return functable.longest_match(s, cur_match);
+static uint8_t* chunkcopy_stub(uint8_t *out, uint8_t const *from, unsigned len) {
+    functable_init();
+    return functable.chunkcopy(out, from, len);
 }
 
-Z_INTERNAL uint32_t longest_match_slow_stub(deflate_state *const s, Pos cur_match) {
+static uint8_t* chunkcopy_safe_stub(uint8_t *out, uint8_t const *from, unsigned len, uint8_t *safe) {
+    functable_init();
+    return functable.chunkcopy_safe(out, from, len, safe);
+}
 
-    functable.longest_match_slow = &longest_match_slow_c;
+static uint8_t* chunkunroll_stub(uint8_t *out, unsigned *dist, unsigned *len) {
+    functable_init();
+    return functable.chunkunroll(out, dist, len);
+}
 
-#ifdef UNALIGNED_OK
-#  if defined(UNALIGNED64_OK) && defined(HAVE_BUILTIN_CTZLL)
-    functable.longest_match_slow = &longest_match_slow_unaligned_64;
-#  elif defined(HAVE_BUILTIN_CTZ)
-    functable.longest_match_slow = &longest_match_slow_unaligned_32;
-#  else
-    functable.longest_match_slow = &longest_match_slow_unaligned_16;
-#  endif
-#  ifdef X86_SSE42_CMP_STR
-    if (x86_cpu_has_sse42)
-        functable.longest_match_slow = &longest_match_slow_unaligned_sse4;
-#  endif
-#  if defined(X86_AVX2) && defined(HAVE_BUILTIN_CTZ)
-    if (x86_cpu_has_avx2)
-        functable.longest_match_slow = &longest_match_slow_unaligned_avx2;
-#  endif
+static uint8_t* chunkmemset_stub(uint8_t *out, unsigned dist, unsigned len) {
+    functable_init();
+    return functable.chunkmemset(out, dist, len);
+}
+
+static uint8_t* chunkmemset_safe_stub(uint8_t *out, unsigned dist, unsigned len, unsigned left) {
+    functable_init();
+    return functable.chunkmemset_safe(out, dist, len, left);
+}
+
+static block_state deflate_fast_stub(deflate_state *s, int flush) {
+    functable_init();
+    return functable.deflate_fast(s, flush);
+}
+
+#ifndef NO_MEDIUM_STRATEGY
+static block_state deflate_medium_stub(deflate_state *s, int flush) {
+    functable_init();
+    return functable.deflate_medium(s, flush);
+}
 #endif
 
-    return functable.longest_match_slow(s, cur_match);
+static block_state deflate_slow_stub(deflate_state *s, int flush) {
+    functable_init();
+    return functable.deflate_slow(s, flush);
 }
 
+#ifdef HAVE_IFUNC
+/* With GNU indirect functions the dynamic loader calls these resolvers while
+ * relocating the library, so the table is complete before any thread can call
+ * in and the public checksum entry points are bound directly to the selected
+ * implementation instead of loading it from the table on every call. */
+typedef uint32_t (*adler32_func)(uint32_t adler, const unsigned char *buf, size_t len);
+typedef uint32_t (*crc32_func)(uint32_t crc, const unsigned char *buf, uint64_t len);
+
+static adler32_func adler32_resolve(void) {
+    functable_init();
+    return functable.adler32;
+}
+
+static crc32_func crc32_resolve(void) {
+    functable_init();
+    return functable.crc32;
+}
+
+Z_INTERNAL uint32_t adler32_ifunc(uint32_t adler, const unsigned char *buf, size_t len)
+    __attribute__((ifunc("adler32_resolve")));
+Z_INTERNAL uint32_t crc32_ifunc(uint32_t crc, const unsigned char *buf, uint64_t len)
+    __attribute__((ifunc("crc32_resolve")));
+#endif
+
 /* functable init */
-Z_INTERNAL Z_TLS struct functable_s functable = {
+Z_INTERNAL struct functable_s functable = {
     update_hash_stub,
     insert_string_stub,
     quick_insert_string_stub,
     adler32_stub,
     crc32_stub,
+    adler32_x4_stub,
+    crc32_x4_stub,
     slide_hash_stub,
     compare258_stub,
     longest_match_stub,
@@ -568,5 +747,10 @@ Z_INTERNAL Z_TLS struct functable_s functable = {
     chunkcopy_safe_stub,
     chunkunroll_stub,
     chunkmemset_stub,
-    chunkmemset_safe_stub
+    chunkmemset_safe_stub,
+    deflate_fast_stub,
+#ifndef NO_MEDIUM_STRATEGY
+    deflate_medium_stub,
+#endif
+    deflate_slow_stub
 };
@@ -14,6 +14,8 @@ struct functable_s {
     Pos      (* quick_insert_string)(deflate_state *const s, uint32_t str);
     uint32_t (* adler32)            (uint32_t adler, const unsigned char *buf, size_t len);
     uint32_t (* crc32)              (uint32_t crc, const unsigned char *buf, uint64_t len);
+    void     (* adler32_x4)         (uint32_t sum[4], const unsigned char *buf[4], size_t len);
+    void     (* crc32_x4)           (uint32_t sum[4], const unsigned char *buf[4], size_t len);
     void     (* slide_hash)         (deflate_state *s);
     uint32_t (* compare258)         (const unsigned char *src0, const unsigned char *src1);
     uint32_t (* longest_match)      (deflate_state *const s, Pos cur_match);
@@ -24,8 +26,27 @@ struct functable_s {
     uint8_t* (* chunkunroll)        (uint8_t *out, unsigned *dist, unsigned *len);
     uint8_t* (* chunkmemset)        (uint8_t *out, unsigned dist, unsigned len);
     uint8_t* (* chunkmemset_safe)   (uint8_t *out, unsigned dist, unsigned len, unsigned left);
+    block_state (* deflate_fast)    (deflate_state *s, int flush);
+#ifndef NO_MEDIUM_STRATEGY
+    block_state (* deflate_medium)  (deflate_state *s, int flush);
+#endif
+    block_state (* deflate_slow)    (deflate_state *s, int flush);
 };
 
-Z_INTERNAL extern Z_TLS struct functable_s functable;
+Z_INTERNAL extern struct functable_s functable;
+
+/* Detect cpu features and fill in the table, only does work on the first call */
+void Z_INTERNAL functable_init(void);
+
+/* Public checksum entry points, bound at load time when ifunc is available */
+#ifdef HAVE_IFUNC
+uint32_t Z_INTERNAL adler32_ifunc(uint32_t adler, const unsigned char *buf, size_t len);
+uint32_t Z_INTERNAL crc32_ifunc(uint32_t crc, const unsigned char *buf, uint64_t len);
+#  define FUNCTABLE_ADLER32 adler32_ifunc
+#  define FUNCTABLE_CRC32   crc32_ifunc
+#else
+#  define FUNCTABLE_ADLER32 functable.adler32
+#  define FUNCTABLE_CRC32   functable.crc32
+#endif
 
 #endif
@@ -42,6 +42,7 @@
 /* function prototypes */
 static int inflateStateCheck(PREFIX3(stream) *strm);
 static int updatewindow(PREFIX3(stream) *strm, const unsigned char *end, uint32_t copy);
+static void detachwindow(struct inflate_state *state);
 static uint32_t syncsearch(uint32_t *have, const unsigned char *buf, uint32_t len);
 
 static int inflateStateCheck(PREFIX3(stream) *strm) {
@@ -87,6 +88,7 @@ int32_t Z_EXPORT PREFIX(inflateReset)(PREFIX3(stream) *strm) {
     if (inflateStateCheck(strm))
         return Z_STREAM_ERROR;
     state = (struct inflate_state *)strm->state;
+    detachwindow(state);
     state->wsize = 0;
     state->whave = 0;
     state->wnext = 0;
@@ -117,6 +119,7 @@ int32_t Z_EXPORT PREFIX(inflateReset2)(PREFIX3(stream) *strm, int32_t windowBits
     /* set number of window bits, free window if different */
     if (windowBits && (windowBits < 8 || windowBits > 15))
         return Z_STREAM_ERROR;
+    detachwindow(state);
     if (state->window != NULL && state->wbits != (unsigned)windowBits) {
         ZFREE_WINDOW(strm, state->window);
         state->window = NULL;
@@ -132,11 +135,7 @@ int32_t Z_EXPORT PREFIX(inflateInit2_)(PREFIX3(stream) *strm, int32_t windowBits
     int32_t ret;
     struct inflate_state *state;
 
-#if defined(X86_FEATURES)
-    x86_check_features();
-#elif defined(ARM_FEATURES)
-    arm_check_features();
-#endif
+    functable_init();
 
     if (version == NULL || version[0] != PREFIX2(VERSION)[0] || stream_size != (int)(sizeof(PREFIX3(stream))))
         return Z_VERSION_ERROR;
@@ -156,6 +155,9 @@ int32_t Z_EXPORT PREFIX(inflateInit2_)(PREFIX3(stream) *strm, int32_t windowBits
     strm->state = (struct internal_state *)state;
     state->strm = strm;
     state->window = NULL;
+    state->window_buf = NULL;
+    state->window_attached = 0;
+    state->window_hibernated = 0;
     state->mode = HEAD;     /* to pass state test in inflateReset2() */
     state->chunksize = functable.chunksize();
     ret = PREFIX(inflateReset2)(strm, windowBits);
@@ -238,11 +240,32 @@ int Z_INTERNAL inflate_ensure_window(struct inflate_state *state) {
  */
 static int32_t updatewindow(PREFIX3(stream) *strm, const uint8_t *end, uint32_t copy) {
     struct inflate_state *state;
+    const unsigned char *attached = NULL;
+    unsigned char *hibernated = NULL;
     uint32_t dist;
 
     state = (struct inflate_state *)strm->state;
 
-    if (inflate_ensure_window(state)) return 1;
+    /* an attached dictionary is copied once the window has to change, unless
+       the new output replaces all of it, and history kept by inflateHibernate()
+       is freed then */
+    if (state->window_attached) {
+        attached = state->window;
+        if (state->window_hibernated)
+            hibernated = state->window;
+        state->window_hibernated = 0;
+        detachwindow(state);
+    }
+
+    if (inflate_ensure_window(state)) {
+        if (hibernated != NULL)
+            ZFREE(strm, hibernated);
+        return 1;
+    }
+    if (attached != NULL && copy < state->wsize)
+        memcpy(state->window, attached, state->whave);
+    if (hibernated != NULL)
+        ZFREE(strm, hibernated);
 
     /* copy state->wsize or less output bytes into the circular window */
     if (copy >= state->wsize) {
@@ -270,6 +293,21 @@ static int32_t updatewindow(PREFIX3(stream) *strm, const uint8_t *end, uint32_t
     return 0;
 }
 
+/*
+   Stop using an attached dictionary as the window, and take back the window
+   allocated before, if any. The window contents are then to be set again.
+ */
+static void detachwindow(struct inflate_state *state) {
+    if (state->window_attached) {
+        if (state->window_hibernated)
+            ZFREE(state->strm, state->window);
+        state->window = state->window_buf;
+        state->window_buf = NULL;
+        state->window_attached = 0;
+        state->window_hibernated = 0;
+    }
+}
+
 
 /*
    Private macros for inflate()
@@ -1032,7 +1070,7 @@ int32_t Z_EXPORT PREFIX(inflate)(PREFIX3(stream) *strm, int32_t flush) {
   inf_leave:
     RESTORE();
     if (INFLATE_NEED_UPDATEWINDOW(strm) &&
-            (state->wsize || (out != strm->avail_out && state->mode < BAD &&
+            ((state->wsize && !state->window_attached) || (out != strm->avail_out && state->mode < BAD &&
                  (state->mode < CHECK || flush != Z_FINISH)))) {
         if (updatewindow(strm, strm->next_out, out - strm->avail_out)) {
             state->mode = MEM;
@@ -1058,6 +1096,7 @@ int32_t Z_EXPORT PREFIX(inflateEnd)(PREFIX3(stream) *strm) {
     if (inflateStateCheck(strm))
         return Z_STREAM_ERROR;
     state = (struct inflate_state *)strm->state;
+    detachwindow(state);
     if (state->window != NULL)
         ZFREE_WINDOW(strm, state->window);
     ZFREE_STATE(strm, strm->state);
@@ -1115,6 +1154,107 @@ int32_t Z_EXPORT PREFIX(inflateSetDictionary)(PREFIX3(stream) *strm, const uint8
     return Z_OK;
 }
 
+#ifndef ZLIB_COMPAT
+int32_t Z_EXPORT zng_inflateAttachDictionary(zng_stream *strm, const uint8_t *dictionary, uint32_t dictLength) {
+    struct inflate_state *state;
+    unsigned long dictid;
+    uint32_t wsize;
+
+    /* check state */
+    if (inflateStateCheck(strm) || dictionary == NULL)
+        return Z_STREAM_ERROR;
+    state = (struct inflate_state *)strm->state;
+    if (state->wrap != 0 && state->mode != DICT)
+        return Z_STREAM_ERROR;
+
+    /* check for correct dictionary identifier */
+    if (state->mode == DICT) {
+        dictid = functable.adler32(ADLER32_INITIAL_VALUE, dictionary, dictLength);
+        if (dictid != state->check)
+            return Z_DATA_ERROR;
+    }
+
+    /* a window with history, or one kept by arch-specific inflation code,
+       takes a copy of the dictionary */
+    if (state->wsize != 0 || !INFLATE_NEED_UPDATEWINDOW(strm)) {
+        if (updatewindow(strm, dictionary + dictLength, dictLength)) {
+            state->mode = MEM;
+            return Z_MEM_ERROR;
+        }
+        state->havedict = 1;
+        return Z_OK;
+    }
+
+    /* otherwise the last wsize bytes of the dictionary are the window as
+       updatewindow() would have left it, until it has to change */
+    wsize = 1U << state->wbits;
+    if (dictLength > wsize) {
+        dictionary += dictLength - wsize;
+        dictLength = wsize;
+    }
+    state->window_buf = state->window;
+    state->window = (unsigned char *)dictionary;
+    state->window_attached = 1;
+    state->wsize = wsize;
+    state->whave = dictLength;
+    state->wnext = dictLength == wsize ? 0 : dictLength;
+    state->havedict = 1;
+    Tracev((stderr, "inflate:   dictionary attached\n"));
+    return Z_OK;
+}
+
+int32_t Z_EXPORT zng_inflateHibernate(zng_stream *strm) {
+    struct inflate_state *state;
+    unsigned char *history;
+
+    if (inflateStateCheck(strm))
+        return Z_STREAM_ERROR;
+    state = (struct inflate_state *)strm->state;
+    if (state->mode != HEAD && state->mode != TYPE && state->mode != TYPEDO && state->mode != DONE)
+        return Z_BUF_ERROR;
+
+    /* arch-specific inflation code keeps a window of its own */
+    if (!INFLATE_NEED_UPDATEWINDOW(strm) || state->window_hibernated)
+        return Z_OK;
+
+    /* an attached dictionary is history already, the window put aside is not */
+    if (state->window_attached) {
+        if (state->window_buf != NULL)
+            ZFREE_WINDOW(strm, state->window_buf);
+        state->window_buf = NULL;
+        return Z_OK;
+    }
+    if (state->window == NULL)
+        return Z_OK;
+    if (state->whave == 0) {
+        ZFREE_WINDOW(strm, state->window);
+        state->window = NULL;
+        state->wsize = 0;
+        state->wnext = 0;
+        return Z_OK;
+    }
+
+    /* otherwise the history goes in order to a buffer of its size, which is then
+       read in place like an attached dictionary, until the window has to change */
+    history = (unsigned char *)ZALLOC(strm, state->whave, sizeof(unsigned char));
+    if (history == NULL)
+        return Z_MEM_ERROR;
+    if (state->whave == state->wsize) {
+        memcpy(history, state->window + state->wnext, state->wsize - state->wnext);
+        memcpy(history + state->wsize - state->wnext, state->window, state->wnext);
+    } else {
+        memcpy(history, state->window, state->whave);
+    }
+    ZFREE_WINDOW(strm, state->window);
+    state->window = history;
+    state->window_attached = 1;
+    state->window_hibernated = 1;
+    state->wnext = state->whave == state->wsize ? 0 : state->whave;
+    Tracev((stderr, "inflate:   hibernating\n"));
+    return Z_OK;
+}
+#endif
+
 int32_t Z_EXPORT PREFIX(inflateGetHeader)(PREFIX3(stream) *strm, PREFIX(gz_headerp) head) {
     struct inflate_state *state;
 
@@ -1247,7 +1387,7 @@ int32_t Z_EXPORT PREFIX(inflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
     if (copy == NULL)
         return Z_MEM_ERROR;
     window = NULL;
-    if (state->window != NULL) {
+    if (state->window != NULL && (!state->window_attached || state->window_hibernated)) {
         window = (unsigned char *)ZALLOC_WINDOW(source, 1U << state->wbits, sizeof(unsigned char));
         if (window == NULL) {
             ZFREE_STATE(source, copy);
@@ -1265,10 +1405,17 @@ int32_t Z_EXPORT PREFIX(inflateCopy)(PREFIX3(stream) *dest, PREFIX3(stream) *sou
     }
     copy->next = copy->codes + (state->next - state->codes);
     if (window != NULL) {
-        wsize = 1U << state->wbits;
+        wsize = state->window_hibernated ? state->whave : 1U << state->wbits;
         memcpy(window, state->window, wsize);
     }
-    copy->window = window;
+    /* the copy refers to the same attached dictionary, but has its own copy
+       of the history kept by inflateHibernate() */
+    if (!state->window_attached || state->window_hibernated) {
+        copy->window = window;
+        copy->window_attached = 0;
+    }
+    copy->window_buf = NULL;
+    copy->window_hibernated = 0;
     dest->state = (struct internal_state *)copy;
     return Z_OK;
 }
@@ -100,6 +100,9 @@ struct inflate_state {
     uint32_t whave;             /* valid bytes in the window */
     uint32_t wnext;             /* window write index */
     unsigned char *window;      /* allocated sliding window, if needed */
+    unsigned char *window_buf;  /* allocated window put aside while window is attached */
+    int window_attached;        /* true if window points at a dictionary of the application */
+    int window_hibernated;      /* true if the attached window is the history kept by inflateHibernate() */
         /* bit accumulator */
     uint32_t hold;              /* input bit accumulator */
     unsigned bits;              /* number of bits in "in" */
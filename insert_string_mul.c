@@ -0,0 +1,40 @@
+/* insert_string_mul.c -- insert_string multiplicative hash variant over 5 to 8 bytes
+ *
+ * Copyright (C) 1995-2013 Jean-loup Gailly and Mark Adler
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ */
+
+#include "zbuild.h"
+#include "deflate.h"
+
+#define HASH_SLIDE           48
+
+/* The key is read in memory order into the low bytes of val and masked to the
+ * first s->hash_len of them. Its product with the 64-bit golden ratio mixes
+ * every byte into the top bits, which index head. */
+#define HASH_CALC(s, h, val) h = (uint32_t)((((uint64_t)(val) & s->hash_key_mask) * 0x9e3779b97f4a7c15ULL) >> HASH_SLIDE)
+#define HASH_CALC_VAR        h
+#define HASH_CALC_VAR_INIT   uint32_t h = 0
+#define HASH_CALC_VAL_TYPE   uint64_t
+
+#if defined(UNALIGNED64_OK) && BYTE_ORDER == LITTLE_ENDIAN
+#  define HASH_CALC_READ \
+        val = *(uint64_t *)(strstart);
+#else
+#  define HASH_CALC_READ \
+        val  = ((uint64_t)(strstart[0])); \
+        val |= ((uint64_t)(strstart[1]) << 8); \
+        val |= ((uint64_t)(strstart[2]) << 16); \
+        val |= ((uint64_t)(strstart[3]) << 24); \
+        val |= ((uint64_t)(strstart[4]) << 32); \
+        val |= ((uint64_t)(strstart[5]) << 40); \
+        val |= ((uint64_t)(strstart[6]) << 48); \
+        val |= ((uint64_t)(strstart[7]) << 56);
+#endif
+
+#define UPDATE_HASH          update_hash_mul
+#define INSERT_STRING        insert_string_mul
+#define QUICK_INSERT_STRING  quick_insert_string_mul
+
+#include "insert_string_tpl.h"
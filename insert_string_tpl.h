@@ -28,6 +28,12 @@
 #ifndef HASH_CALC_MASK
 #  define HASH_CALC_MASK HASH_MASK
 #endif
+#ifndef INSERT_STRING_LINKAGE
+#  define INSERT_STRING_LINKAGE Z_INTERNAL
+#endif
+#ifndef HASH_CALC_VAL_TYPE
+#  define HASH_CALC_VAL_TYPE uint32_t
+#endif
 #ifndef HASH_CALC_READ
 #  ifdef UNALIGNED_OK
 #    define HASH_CALC_READ \
@@ -47,7 +53,7 @@
  *    input characters, so that a running hash key can be computed from the
  *    previous key instead of complete recalculation each time.
  */
-Z_INTERNAL uint32_t UPDATE_HASH(deflate_state *const s, uint32_t h, uint32_t val) {
+INSERT_STRING_LINKAGE uint32_t UPDATE_HASH(deflate_state *const s, uint32_t h, uint32_t val) {
     (void)s;
     HASH_CALC(s, h, val);
     return h & HASH_CALC_MASK;
@@ -58,10 +64,11 @@ Z_INTERNAL uint32_t UPDATE_HASH(deflate_state *const s, uint32_t h, uint32_t val
  * of the hash chain (the most recent string with same hash key). Return
  * the previous length of the hash chain.
  */
-Z_INTERNAL Pos QUICK_INSERT_STRING(deflate_state *const s, uint32_t str) {
+INSERT_STRING_LINKAGE Pos QUICK_INSERT_STRING(deflate_state *const s, uint32_t str) {
     Pos head;
     uint8_t *strstart = s->window + str + HASH_CALC_OFFSET;
-    uint32_t val, hm;
+    HASH_CALC_VAL_TYPE val;
+    uint32_t hm;
 
     HASH_CALC_VAR_INIT;
     HASH_CALC_READ;
@@ -85,12 +92,13 @@ Z_INTERNAL Pos QUICK_INSERT_STRING(deflate_state *const s, uint32_t str) {
  *    input characters and the first STD_MIN_MATCH bytes of str are valid
  *    (except for the last STD_MIN_MATCH-1 bytes of the input file).
  */
-Z_INTERNAL void INSERT_STRING(deflate_state *const s, uint32_t str, uint32_t count) {
+INSERT_STRING_LINKAGE void INSERT_STRING(deflate_state *const s, uint32_t str, uint32_t count) {
     uint8_t *strstart = s->window + str + HASH_CALC_OFFSET;
     uint8_t *strend = strstart + count;
 
     for (Pos idx = (Pos)str; strstart < strend; idx++, strstart++) {
-        uint32_t val, hm;
+        HASH_CALC_VAL_TYPE val;
+        uint32_t hm;
 
         HASH_CALC_VAR_INIT;
         HASH_CALC_READ;
@@ -27,10 +27,22 @@ typedef uint8_t         bestcmp_t;
 
 #define EARLY_EXIT_TRIGGER_LEVEL 5
 
+/* Bound on the chain entries walked by the lazy evaluation, at the next
+ * position after a match: LAZY_CHAIN_MIN plus LAZY_CHAIN_SCALE times the depth
+ * at which that match was found. A longer match is rarely much deeper in the
+ * chain than that, and walking the rest of it is most of the cost of the
+ * higher levels. This only shortens the walk, no earlier search results are
+ * kept. It costs text up to a few tenths of a percent, which test/deflate_ratio
+ * keeps in check.
+ */
+#define LAZY_CHAIN_MIN   64
+#define LAZY_CHAIN_SCALE 4
+
 #endif
 
 /* Set match_start to the longest match starting at the given string and
- * return its length. Matches shorter or equal to prev_length are discarded,
+ * match_depth to the chain entries walked before it was found, and return its
+ * length. Matches shorter or equal to prev_length are discarded,
  * in which case the result is equal to prev_length and match_start is garbage.
  *
  * IN assertions: cur_match is the head of the hash chain for the current
@@ -51,7 +63,7 @@ Z_INTERNAL uint32_t LONGEST_MATCH(deflate_state *const s, Pos cur_match) {
 #else
     int32_t early_exit;
 #endif
-    uint32_t chain_length, nice_match, best_len, offset;
+    uint32_t chain_length, chain_start, nice_match, best_len, offset;
     uint32_t lookahead = s->lookahead;
     Pos match_offset = 0;
     bestcmp_t scan_end;
@@ -97,6 +109,9 @@ Z_INTERNAL uint32_t LONGEST_MATCH(deflate_state *const s, Pos cur_match) {
     chain_length = s->max_chain_length;
     if (best_len >= s->good_match)
         chain_length >>= 2;
+    if (best_len >= STD_MIN_MATCH)
+        chain_length = MIN(chain_length, LAZY_CHAIN_MIN + s->match_depth * LAZY_CHAIN_SCALE);
+    chain_start = chain_length;
     nice_match = (uint32_t)s->nice_match;
 
     /* Stop when cur_match becomes <= limit. To simplify the code,
@@ -189,6 +204,7 @@ Z_INTERNAL uint32_t LONGEST_MATCH(deflate_state *const s, Pos cur_match) {
         if (len > best_len) {
             uint32_t match_start = cur_match - match_offset;
             s->match_start = match_start;
+            s->match_depth = chain_start - chain_length;
 
             /* Do not look for matches beyond the end of the input. */
             if (len > lookahead)
@@ -0,0 +1,107 @@
+/* benchmark_adaptive.c -- compare Z_ADAPTIVE with the fixed strategies
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Compresses the concatenation of the files given on the command line, or a
+ * generated mix of text, runs and random data, at levels 1, 6 and 9 with each
+ * strategy and reports the compressed size and the best speed out of a few
+ * runs.
+ */
+
+#define _POSIX_C_SOURCE 200112  /* For clock_gettime(). */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "benchmark_shared.h"
+
+#define RUNS          5
+#define MIX_SIZE      (8 * 1024 * 1024)
+#define MIX_SEGMENT   (256 * 1024)
+
+static const struct {
+    int strategy;
+    const char *name;
+} strategies[] = {
+    { Z_DEFAULT_STRATEGY, "default" },
+    { Z_RLE,              "rle" },
+    { Z_HUFFMAN_ONLY,     "huffman" },
+    { Z_ADAPTIVE,         "adaptive" },
+};
+
+static unsigned char *read_files(int argc, char **argv, size_t *size) {
+    unsigned char *buf = NULL;
+    size_t len = 0;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        FILE *f = fopen(argv[i], "rb");
+        long file_len;
+
+        if (f == NULL || fseek(f, 0, SEEK_END) != 0 || (file_len = ftell(f)) < 0) {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            exit(1);
+        }
+        rewind(f);
+        buf = (unsigned char *)realloc(buf, len + (size_t)file_len + 1);
+        if (buf == NULL || fread(buf + len, 1, (size_t)file_len, f) != (size_t)file_len) {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            exit(1);
+        }
+        len += (size_t)file_len;
+        fclose(f);
+    }
+    *size = len;
+    return buf;
+}
+
+int main(int argc, char **argv) {
+    unsigned char *in, *out;
+    size_t in_size, out_size;
+    int levels[] = { 1, 6, 9 };
+    unsigned l, s, run;
+
+    if (argc > 1) {
+        in = read_files(argc, argv, &in_size);
+    } else {
+        in_size = MIX_SIZE;
+        in = generate_mixed(in_size, MIX_SEGMENT, "trx");
+    }
+    out_size = zng_compressBound(in_size);
+    out = (unsigned char *)malloc(out_size);
+    if (out == NULL)
+        return 1;
+
+    printf("%zu bytes of input\n", in_size);
+    for (l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        for (s = 0; s < sizeof(strategies) / sizeof(strategies[0]); s++) {
+            double best = 0;
+            size_t compressed = 0;
+
+            for (run = 0; run < RUNS; run++) {
+                zng_stream strm;
+                double start, elapsed;
+
+                memset(&strm, 0, sizeof(strm));
+                if (zng_deflateInit2(&strm, levels[l], Z_DEFLATED, 15, 8, strategies[s].strategy) != Z_OK)
+                    return 1;
+                strm.next_in = in;
+                strm.avail_in = (uint32_t)in_size;
+                strm.next_out = out;
+                strm.avail_out = (uint32_t)out_size;
+                start = now();
+                if (zng_deflate(&strm, Z_FINISH) != Z_STREAM_END)
+                    return 1;
+                elapsed = now() - start;
+                compressed = strm.total_out;
+                zng_deflateEnd(&strm);
+                if (run == 0 || elapsed < best)
+                    best = elapsed;
+            }
+            printf("level %d %-8s %10zu bytes %6.2f%% %8.1f MB/s\n", levels[l], strategies[s].name,
+                   compressed, 100.0 * compressed / in_size, in_size / best * 1e3);
+        }
+    }
+    free(out);
+    free(in);
+    return 0;
+}
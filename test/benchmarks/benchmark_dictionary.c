@@ -0,0 +1,188 @@
+/* benchmark_dictionary.c -- compare deflateSetDictionary() with a shared dictionary
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Compresses a stream of small messages with a 32K preset dictionary, resetting
+ * the stream and setting the dictionary for each, once with deflateSetDictionary()
+ * and once with deflateUseDictionary() of a dictionary created up front, and
+ * reports the best time per message out of a few runs. Then inflates them back,
+ * once with inflateSetDictionary() and once with inflateAttachDictionary(). The
+ * messages are taken from the file given on the command line, or from generated
+ * text.
+ */
+
+#define _POSIX_C_SOURCE 200112  /* For clock_gettime(). */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "benchmark_shared.h"
+
+#define RUNS          5
+#define DICT_SIZE     32768
+#define CORPUS_SIZE   (4 * 1024 * 1024)
+
+/* Compress the input after the dictionary in messages of msg_size bytes */
+static double compress_messages(zng_stream *strm, const zng_deflate_dictionary *dict, unsigned char *in,
+                                size_t in_size, size_t msg_size, unsigned char *out, size_t *compressed) {
+    double start = now();
+    size_t pos;
+
+    *compressed = 0;
+    for (pos = DICT_SIZE; pos + msg_size <= in_size; pos += msg_size) {
+        zng_deflateReset(strm);
+        if (dict != NULL)
+            zng_deflateUseDictionary(strm, dict);
+        else
+            zng_deflateSetDictionary(strm, in, DICT_SIZE);
+        strm->next_in = in + pos;
+        strm->avail_in = (uint32_t)msg_size;
+        strm->next_out = out;
+        strm->avail_out = (uint32_t)(msg_size * 2 + 64);
+        if (zng_deflate(strm, Z_FINISH) != Z_STREAM_END)
+            exit(1);
+        *compressed += strm->total_out;
+    }
+    return now() - start;
+}
+
+/* Inflate the messages compressed one after the other in compr, each of compr_sizes bytes */
+static double inflate_messages(zng_stream *strm, int attach, unsigned char *in, size_t in_size, size_t msg_size,
+                               unsigned char *compr, const uint32_t *compr_sizes, unsigned char *out) {
+    double start = now();
+    size_t pos, m;
+
+    for (pos = DICT_SIZE, m = 0; pos + msg_size <= in_size; pos += msg_size, m++) {
+        zng_inflateReset(strm);
+        if (attach)
+            zng_inflateAttachDictionary(strm, in, DICT_SIZE);
+        else
+            zng_inflateSetDictionary(strm, in, DICT_SIZE);
+        strm->next_in = compr;
+        strm->avail_in = compr_sizes[m];
+        strm->next_out = out;
+        strm->avail_out = (uint32_t)msg_size;
+        if (zng_inflate(strm, Z_FINISH) != Z_STREAM_END || memcmp(out, in + pos, msg_size) != 0)
+            exit(1);
+        compr += compr_sizes[m];
+    }
+    return now() - start;
+}
+
+/* Compress the messages at level 6 and time inflating them back */
+static void benchmark_inflate(unsigned char *in, size_t in_size, size_t msg_size) {
+    size_t messages = (in_size - DICT_SIZE) / msg_size, pos, m, total = 0;
+    double set_best = 0, attach_best = 0, elapsed;
+    unsigned char *compr, *out;
+    uint32_t *compr_sizes;
+    zng_stream strm;
+    unsigned run;
+
+    compr = (unsigned char *)malloc(messages * (msg_size * 2 + 64));
+    compr_sizes = (uint32_t *)malloc(messages * sizeof(uint32_t));
+    out = (unsigned char *)malloc(msg_size);
+    if (compr == NULL || compr_sizes == NULL || out == NULL)
+        exit(1);
+
+    memset(&strm, 0, sizeof(strm));
+    if (zng_deflateInit2(&strm, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        exit(1);
+    for (pos = DICT_SIZE, m = 0; pos + msg_size <= in_size; pos += msg_size, m++) {
+        zng_deflateReset(&strm);
+        zng_deflateSetDictionary(&strm, in, DICT_SIZE);
+        strm.next_in = in + pos;
+        strm.avail_in = (uint32_t)msg_size;
+        strm.next_out = compr + total;
+        strm.avail_out = (uint32_t)(msg_size * 2 + 64);
+        if (zng_deflate(&strm, Z_FINISH) != Z_STREAM_END)
+            exit(1);
+        compr_sizes[m] = (uint32_t)strm.total_out;
+        total += strm.total_out;
+    }
+    zng_deflateEnd(&strm);
+
+    memset(&strm, 0, sizeof(strm));
+    if (zng_inflateInit2(&strm, -15) != Z_OK)
+        exit(1);
+    for (run = 0; run < RUNS; run++) {
+        elapsed = inflate_messages(&strm, 0, in, in_size, msg_size, compr, compr_sizes, out);
+        if (run == 0 || elapsed < set_best)
+            set_best = elapsed;
+        elapsed = inflate_messages(&strm, 1, in, in_size, msg_size, compr, compr_sizes, out);
+        if (run == 0 || elapsed < attach_best)
+            attach_best = elapsed;
+    }
+    zng_inflateEnd(&strm);
+    printf("inflate message %4zu %10zu bytes   set %8.2f us   attach %8.2f us per message\n", msg_size, total,
+           set_best / messages / 1e3, attach_best / messages / 1e3);
+    free(out);
+    free(compr_sizes);
+    free(compr);
+}
+
+static void benchmark(const char *name, unsigned char *in, size_t in_size) {
+    static const int levels[] = { 1, 6, 9 };
+    static const size_t msg_sizes[] = { 256, 1024, 4096 };
+    unsigned char *out;
+    unsigned l, m, run;
+
+    if (in_size < DICT_SIZE + 4096) {
+        fprintf(stderr, "%s is too small\n", name);
+        return;
+    }
+    out = (unsigned char *)malloc(4096 * 2 + 64);
+    if (out == NULL)
+        exit(1);
+
+    printf("%s: %zu bytes of messages after a %d byte dictionary\n", name, in_size - DICT_SIZE, DICT_SIZE);
+    for (l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        for (m = 0; m < sizeof(msg_sizes) / sizeof(msg_sizes[0]); m++) {
+            size_t messages = (in_size - DICT_SIZE) / msg_sizes[m], set_size = 0, use_size = 0;
+            double set_best = 0, use_best = 0, elapsed;
+            zng_deflate_dictionary *dict;
+            zng_stream strm;
+
+            memset(&strm, 0, sizeof(strm));
+            if (zng_deflateInit2(&strm, levels[l], Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+                exit(1);
+            dict = zng_deflateDictionaryCreate(&strm, in, DICT_SIZE);
+            if (dict == NULL)
+                exit(1);
+            for (run = 0; run < RUNS; run++) {
+                elapsed = compress_messages(&strm, NULL, in, in_size, msg_sizes[m], out, &set_size);
+                if (run == 0 || elapsed < set_best)
+                    set_best = elapsed;
+                elapsed = compress_messages(&strm, dict, in, in_size, msg_sizes[m], out, &use_size);
+                if (run == 0 || elapsed < use_best)
+                    use_best = elapsed;
+            }
+            if (set_size != use_size)
+                fprintf(stderr, "output sizes differ: %zu and %zu\n", set_size, use_size);
+            printf("level %d message %4zu %10zu bytes   set %8.2f us   use %8.2f us per message\n", levels[l],
+                   msg_sizes[m], use_size, set_best / messages / 1e3, use_best / messages / 1e3);
+            zng_deflateDictionaryFree(dict);
+            zng_deflateEnd(&strm);
+        }
+    }
+    for (m = 0; m < sizeof(msg_sizes) / sizeof(msg_sizes[0]); m++)
+        benchmark_inflate(in, in_size, msg_sizes[m]);
+    free(out);
+}
+
+int main(int argc, char **argv) {
+    unsigned char *in;
+    size_t in_size;
+    int i;
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++) {
+            in = read_file(argv[i], &in_size);
+            benchmark(argv[i], in, in_size);
+            free(in);
+        }
+    } else {
+        in = generate_mixed(CORPUS_SIZE, CORPUS_SIZE, "t");
+        benchmark("text", in, CORPUS_SIZE);
+        free(in);
+    }
+    return 0;
+}
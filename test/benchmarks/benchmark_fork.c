@@ -0,0 +1,118 @@
+/* benchmark_fork.c -- compare deflateCopy() with deflateFork()
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Compresses some of the input, then copies the stream many times over, once
+ * with deflateCopy() and deflateEnd() of each copy, once with deflateFork() into
+ * a new stream and deflateEnd() of it, once with deflateFork() into the same
+ * stream each time, and once more like that with a flush of the fork, which
+ * copies the hash table it shares, and reports the best time per copy out of a
+ * few runs.
+ * The input is taken from the file given on the command line, or is generated
+ * text.
+ */
+
+#define _POSIX_C_SOURCE 200112  /* For clock_gettime(). */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "benchmark_shared.h"
+
+#define RUNS          5
+#define COPIES        2000
+#define CORPUS_SIZE   (1024 * 1024)
+
+enum { COPY, FORK_NEW, FORK_REUSE, FORK_FLUSH };
+
+static double copy_stream(zng_stream *strm, int how) {
+    static unsigned char flushed[64];
+    double start = now();
+    zng_stream dest;
+    unsigned i;
+
+    memset(&dest, 0, sizeof(dest));
+    for (i = 0; i < COPIES; i++) {
+        if (how == COPY) {
+            if (zng_deflateCopy(&dest, strm) != Z_OK)
+                exit(1);
+            zng_deflateEnd(&dest);
+        } else {
+            if (zng_deflateFork(&dest, strm) != Z_OK)
+                exit(1);
+            if (how == FORK_NEW)
+                zng_deflateEnd(&dest);
+            if (how == FORK_FLUSH) {
+                dest.next_out = flushed;
+                dest.avail_out = sizeof(flushed);
+                if (zng_deflate(&dest, Z_SYNC_FLUSH) == Z_STREAM_ERROR)
+                    exit(1);
+            }
+        }
+    }
+    if (how >= FORK_REUSE)
+        zng_deflateEnd(&dest);
+    return now() - start;
+}
+
+static void benchmark(const char *name, unsigned char *in, size_t in_size) {
+    static const size_t fork_at[] = { 256, 4096, 65536 };
+    static const int mem_levels[] = { 8, 9 };
+    unsigned char *out;
+    unsigned f, m, run;
+    int how;
+
+    out = (unsigned char *)malloc(in_size * 2 + 64);
+    if (out == NULL)
+        exit(1);
+
+    printf("%s: %zu bytes\n", name, in_size);
+    for (m = 0; m < sizeof(mem_levels) / sizeof(mem_levels[0]); m++) {
+        for (f = 0; f < sizeof(fork_at) / sizeof(fork_at[0]); f++) {
+            double best[4] = { 0, 0, 0, 0 }, elapsed;
+            zng_stream strm;
+
+            if (fork_at[f] > in_size)
+                continue;
+            memset(&strm, 0, sizeof(strm));
+            if (zng_deflateInit2(&strm, 6, Z_DEFLATED, 15, mem_levels[m], Z_DEFAULT_STRATEGY) != Z_OK)
+                exit(1);
+            strm.next_in = in;
+            strm.avail_in = (uint32_t)fork_at[f];
+            strm.next_out = out;
+            strm.avail_out = (uint32_t)(in_size * 2 + 64);
+            if (zng_deflate(&strm, Z_NO_FLUSH) != Z_OK)
+                exit(1);
+            for (run = 0; run < RUNS; run++) {
+                for (how = COPY; how <= FORK_FLUSH; how++) {
+                    elapsed = copy_stream(&strm, how);
+                    if (run == 0 || elapsed < best[how])
+                        best[how] = elapsed;
+                }
+            }
+            printf("memLevel %d after %6zu bytes   copy %8.2f us   fork %8.2f us   fork reused %8.2f us   "
+                   "and flushed %8.2f us per copy\n", mem_levels[m], fork_at[f], best[COPY] / COPIES / 1e3,
+                   best[FORK_NEW] / COPIES / 1e3, best[FORK_REUSE] / COPIES / 1e3, best[FORK_FLUSH] / COPIES / 1e3);
+            zng_deflateEnd(&strm);
+        }
+    }
+    free(out);
+}
+
+int main(int argc, char **argv) {
+    unsigned char *in;
+    size_t in_size;
+    int i;
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++) {
+            in = read_file(argv[i], &in_size);
+            benchmark(argv[i], in, in_size);
+            free(in);
+        }
+    } else {
+        in = generate_mixed(CORPUS_SIZE, CORPUS_SIZE, "t");
+        benchmark("text", in, CORPUS_SIZE);
+        free(in);
+    }
+    return 0;
+}
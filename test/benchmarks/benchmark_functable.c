@@ -0,0 +1,71 @@
+/* benchmark_functable.c -- measure the cost of runtime function dispatch
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Reports the per-call cost of a short checksum, which is dominated by the
+ * dispatch through the function table, and the latency of the first call made
+ * by a freshly created thread.
+ */
+
+#define _POSIX_C_SOURCE 200112  /* For clock_gettime(). */
+
+#include <pthread.h>
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "benchmark_shared.h"
+
+#define CALLS       (20 * 1000 * 1000)
+#define THREADS     2000
+
+static unsigned char data[8];
+static volatile uint32_t sink;
+
+static void *first_call(void *arg) {
+    double *elapsed = (double *)arg;
+    double start = now();
+
+    sink = (uint32_t)PREFIX(crc32)(0, data, sizeof(data));
+    sink = (uint32_t)PREFIX(adler32)(1, data, sizeof(data));
+    *elapsed = now() - start;
+    return NULL;
+}
+
+int main(void) {
+    double start, elapsed, total = 0;
+    uint32_t crc = 0, adler = 1;
+    int i;
+
+    for (i = 0; i < (int)sizeof(data); i++)
+        data[i] = (unsigned char)i;
+
+    start = now();
+    for (i = 0; i < CALLS; i++)
+        crc ^= (uint32_t)PREFIX(crc32)(0, data, sizeof(data));
+    elapsed = now() - start;
+    printf("crc32 %zu bytes:   %6.2f ns/call\n", sizeof(data), elapsed / CALLS);
+
+    start = now();
+    for (i = 0; i < CALLS; i++)
+        adler ^= (uint32_t)PREFIX(adler32)(1, data, sizeof(data));
+    elapsed = now() - start;
+    printf("adler32 %zu bytes: %6.2f ns/call\n", sizeof(data), elapsed / CALLS);
+    sink = crc ^ adler;
+
+    for (i = 0; i < THREADS; i++) {
+        pthread_t thread;
+
+        if (pthread_create(&thread, NULL, first_call, &elapsed) != 0) {
+            fprintf(stderr, "pthread_create failed\n");
+            return 1;
+        }
+        pthread_join(thread, NULL);
+        total += elapsed;
+    }
+    printf("first call per new thread: %6.2f ns\n", total / THREADS);
+    return 0;
+}
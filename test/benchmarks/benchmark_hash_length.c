@@ -0,0 +1,121 @@
+/* benchmark_hash_length.c -- compare the hash key lengths of Z_DEFLATE_HASH_LENGTH
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Compresses each file given on the command line, or a generated text and a
+ * generated table of binary records, at levels 1, 3, 6 and 8 with each hash
+ * length and reports the compressed size and the best speed out of a few runs.
+ * Level 9 is left out, it always hashes 3 bytes.
+ */
+
+#define _POSIX_C_SOURCE 200112  /* For clock_gettime(). */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "benchmark_shared.h"
+
+#define RUNS          5
+#define CORPUS_SIZE   (8 * 1024 * 1024)
+
+/* Little-endian records of a counter, a timestamp, a few flags and a value
+ * drawn from a small set, the kind of table whose fields share short byte
+ * sequences at every offset */
+static unsigned char *generate_records(size_t *size) {
+    unsigned char *buf = (unsigned char *)malloc(CORPUS_SIZE);
+    uint32_t seed = 1, id = 0, time = 1600000000;
+    size_t pos, i;
+
+    if (buf == NULL)
+        exit(1);
+    for (pos = 0; pos + 16 <= CORPUS_SIZE; pos += 16, id++) {
+        test_rand(&seed);
+        time += (seed >> 28);
+        for (i = 0; i < 4; i++) {
+            buf[pos + i] = (unsigned char)(id >> (8 * i));
+            buf[pos + 4 + i] = (unsigned char)(time >> (8 * i));
+        }
+        buf[pos + 8] = (unsigned char)((seed >> 16) & 0x7);
+        buf[pos + 9] = 0;
+        buf[pos + 10] = (unsigned char)(seed >> 20);
+        buf[pos + 11] = 0;
+        for (i = 0; i < 4; i++)
+            buf[pos + 12 + i] = (unsigned char)((1000u << ((seed >> 24) % 4)) >> (8 * i));
+    }
+    memset(buf + pos, 0, CORPUS_SIZE - pos);
+    *size = CORPUS_SIZE;
+    return buf;
+}
+
+static void benchmark(const char *name, unsigned char *in, size_t in_size) {
+    static const int levels[] = { 1, 3, 6, 8 };
+    static const int hash_lens[] = { 4, 5, 6, 8 };
+    unsigned char *out;
+    size_t out_size;
+    unsigned l, h, run;
+
+    out_size = (size_t)zng_compressBound((unsigned long)in_size);
+    out = (unsigned char *)malloc(out_size);
+    if (out == NULL)
+        exit(1);
+
+    printf("%s: %zu bytes of input\n", name, in_size);
+    for (l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        for (h = 0; h < sizeof(hash_lens) / sizeof(hash_lens[0]); h++) {
+            double best = 0;
+            size_t compressed = 0;
+
+            for (run = 0; run < RUNS; run++) {
+                zng_stream strm;
+                zng_deflate_param_value param;
+                int hash_len = hash_lens[h];
+                double start, elapsed;
+
+                memset(&strm, 0, sizeof(strm));
+                if (zng_deflateInit(&strm, levels[l]) != Z_OK)
+                    exit(1);
+                param.param = Z_DEFLATE_HASH_LENGTH;
+                param.buf = &hash_len;
+                param.size = sizeof(hash_len);
+                if (zng_deflateSetParams(&strm, &param, 1) != Z_OK)
+                    exit(1);
+                strm.next_in = in;
+                strm.avail_in = (uint32_t)in_size;
+                strm.next_out = out;
+                strm.avail_out = (uint32_t)out_size;
+                start = now();
+                if (zng_deflate(&strm, Z_FINISH) != Z_STREAM_END)
+                    exit(1);
+                elapsed = now() - start;
+                compressed = strm.total_out;
+                zng_deflateEnd(&strm);
+                if (run == 0 || elapsed < best)
+                    best = elapsed;
+            }
+            printf("level %d hash %d %10zu bytes %6.2f%% %8.1f MB/s\n", levels[l], hash_lens[h],
+                   compressed, 100.0 * compressed / in_size, in_size / best * 1e3);
+        }
+    }
+    free(out);
+}
+
+int main(int argc, char **argv) {
+    unsigned char *in;
+    size_t in_size;
+    int i;
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++) {
+            in = read_file(argv[i], &in_size);
+            benchmark(argv[i], in, in_size);
+            free(in);
+        }
+    } else {
+        in = generate_mixed(CORPUS_SIZE, CORPUS_SIZE, "t");
+        benchmark("text", in, CORPUS_SIZE);
+        free(in);
+        in = generate_records(&in_size);
+        benchmark("records", in, in_size);
+        free(in);
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+/* benchmark_hibernate.c -- measure deflateHibernate() and inflateHibernate()
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Sends messages through a deflate and an inflate stream with Z_SYNC_FLUSH,
+ * once as they are and once hibernating both streams after each message, and
+ * reports the memory the streams hold between messages and the best time per
+ * message out of a few runs. The messages are taken from the file given on
+ * the command line, or from generated text.
+ */
+
+#define _POSIX_C_SOURCE 200112  /* For clock_gettime(). */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "benchmark_shared.h"
+
+#define RUNS          5
+#define CORPUS_SIZE   (256 * 1024)
+
+static size_t allocated;
+
+/* Allocator counting the bytes in use */
+static void *count_alloc(void *opaque, unsigned items, unsigned size) {
+    size_t *block = (size_t *)malloc(sizeof(size_t) * 2 + (size_t)items * size);
+    (void)opaque;
+    if (block == NULL)
+        return NULL;
+    block[0] = (size_t)items * size;
+    allocated += block[0];
+    return block + 2;
+}
+
+static void count_free(void *opaque, void *address) {
+    size_t *block = (size_t *)address - 2;
+    (void)opaque;
+    allocated -= block[0];
+    free(block);
+}
+
+/* Send the messages through new streams, and return the time taken */
+static double send_messages(int level, int hibernate, unsigned char *in, size_t in_size, size_t msg_size,
+                            size_t *idle) {
+    unsigned char *compr = (unsigned char *)malloc(msg_size * 2 + 64), *out = (unsigned char *)malloc(msg_size);
+    zng_stream strm, inf;
+    size_t pos;
+    double start;
+
+    if (compr == NULL || out == NULL)
+        exit(1);
+    memset(&strm, 0, sizeof(strm));
+    strm.zalloc = count_alloc;
+    strm.zfree = count_free;
+    memset(&inf, 0, sizeof(inf));
+    inf.zalloc = count_alloc;
+    inf.zfree = count_free;
+    if (zng_deflateInit2(&strm, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK ||
+        zng_inflateInit2(&inf, -15) != Z_OK)
+        exit(1);
+
+    start = now();
+    *idle = 0;
+    for (pos = 0; pos + msg_size <= in_size; pos += msg_size) {
+        strm.next_in = in + pos;
+        strm.avail_in = (uint32_t)msg_size;
+        strm.next_out = compr;
+        strm.avail_out = (uint32_t)(msg_size * 2 + 64);
+        if (zng_deflate(&strm, Z_SYNC_FLUSH) != Z_OK)
+            exit(1);
+        inf.next_in = compr;
+        inf.avail_in = (uint32_t)(strm.next_out - compr);
+        inf.next_out = out;
+        inf.avail_out = (uint32_t)msg_size;
+        if (zng_inflate(&inf, Z_SYNC_FLUSH) != Z_OK || inf.avail_out != 0)
+            exit(1);
+        if (hibernate && (zng_deflateHibernate(&strm) != Z_OK || zng_inflateHibernate(&inf) != Z_OK))
+            exit(1);
+        *idle = MAX(*idle, allocated);
+    }
+    start = now() - start;
+
+    if (memcmp(out, in + pos - msg_size, msg_size) != 0)
+        exit(1);
+    zng_deflateEnd(&strm);
+    zng_inflateEnd(&inf);
+    free(out);
+    free(compr);
+    return start;
+}
+
+static void benchmark(const char *name, unsigned char *in, size_t in_size) {
+    static const int levels[] = { 1, 6, 9 };
+    static const size_t msg_sizes[] = { 256, 4096 };
+    unsigned l, m, run;
+
+    printf("%s: %zu bytes\n", name, in_size);
+    for (l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        for (m = 0; m < sizeof(msg_sizes) / sizeof(msg_sizes[0]); m++) {
+            size_t messages = in_size / msg_sizes[m], idle, idle_hibernated;
+            double best = 0, best_hibernated = 0, elapsed;
+
+            if (messages == 0)
+                continue;
+            for (run = 0; run < RUNS; run++) {
+                elapsed = send_messages(levels[l], 0, in, in_size, msg_sizes[m], &idle);
+                if (run == 0 || elapsed < best)
+                    best = elapsed;
+                elapsed = send_messages(levels[l], 1, in, in_size, msg_sizes[m], &idle_hibernated);
+                if (run == 0 || elapsed < best_hibernated)
+                    best_hibernated = elapsed;
+            }
+            printf("level %d message %4zu   idle %7zu -> %6zu bytes   %8.2f -> %8.2f us per message\n", levels[l],
+                   msg_sizes[m], idle, idle_hibernated, best / messages / 1e3, best_hibernated / messages / 1e3);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    unsigned char *in;
+    size_t in_size;
+    int i;
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++) {
+            in = read_file(argv[i], &in_size);
+            benchmark(argv[i], in, in_size);
+            free(in);
+        }
+    } else {
+        in = generate_mixed(CORPUS_SIZE, CORPUS_SIZE, "t");
+        benchmark("text", in, CORPUS_SIZE);
+        free(in);
+    }
+    return 0;
+}
@@ -0,0 +1,52 @@
+/* benchmark_shared.h -- timing and input shared by the benchmarks
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Include after zbuild.h and zlib.h or zlib-ng.h, with _POSIX_C_SOURCE
+ * defined for clock_gettime().
+ */
+
+#ifndef BENCHMARK_SHARED_H_
+#define BENCHMARK_SHARED_H_
+
+#include <time.h>
+
+#include "../test_shared.h"
+
+static inline double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static inline unsigned char *read_file(const char *name, size_t *size) {
+    unsigned char *buf;
+    FILE *f = fopen(name, "rb");
+    long len;
+
+    if (f == NULL || fseek(f, 0, SEEK_END) != 0 || (len = ftell(f)) < 0) {
+        fprintf(stderr, "cannot read %s\n", name);
+        exit(1);
+    }
+    rewind(f);
+    buf = (unsigned char *)malloc((size_t)len + 1);
+    if (buf == NULL || fread(buf, 1, (size_t)len, f) != (size_t)len) {
+        fprintf(stderr, "cannot read %s\n", name);
+        exit(1);
+    }
+    fclose(f);
+    *size = (size_t)len;
+    return buf;
+}
+
+/* size bytes of the mixed input of test_fill_mixed() */
+static inline unsigned char *generate_mixed(size_t size, size_t segment, const char *kinds) {
+    unsigned char *buf = (unsigned char *)malloc(size);
+    uint32_t seed = 1;
+
+    if (buf == NULL)
+        exit(1);
+    test_fill_mixed(buf, size, segment, kinds, &seed);
+    return buf;
+}
+
+#endif
@@ -0,0 +1,153 @@
+/* benchmark_small_blocks.c -- measure deflate on many small sync-flushed blocks
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Compresses each file given on the command line, or a generated text and a
+ * generated table of binary records, flushing with Z_SYNC_FLUSH after every
+ * block of 256, 1024 or 4096 bytes, and reports the best time per block out
+ * of a few runs. Each of these blocks is sent with its own Huffman trees, so
+ * building the trees of their sparse alphabets is a large part of the time.
+ */
+
+#define _POSIX_C_SOURCE 200112  /* For clock_gettime(). */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "benchmark_shared.h"
+
+#define RUNS          5
+#define CORPUS_SIZE   (4 * 1024 * 1024)
+
+/* Text of words drawn with a skewed distribution, like the messages of a
+ * chat or a log */
+static unsigned char *generate_text(size_t *size) {
+    static const char *words[] = { "the ", "a ", "of ", "to ", "and ", "in ", "is ", "that ", "for ", "it ",
+                                   "with ", "as ", "was ", "on ", "request ", "server ", "user ", "error ",
+                                   "connection ", "timeout ", "value ", "Message ", "42 ", "1337 ", ", ",
+                                   ". ", "\n" };
+    unsigned char *buf = (unsigned char *)malloc(CORPUS_SIZE);
+    uint32_t seed = 1, r;
+    size_t pos = 0, count = sizeof(words) / sizeof(words[0]);
+
+    if (buf == NULL)
+        exit(1);
+    while (pos < CORPUS_SIZE) {
+        const char *word;
+        r = test_rand(&seed) % (uint32_t)count;
+        /* Squaring favours the first words */
+        word = words[r * r / count];
+        while (*word && pos < CORPUS_SIZE)
+            buf[pos++] = (unsigned char)*word++;
+    }
+    *size = CORPUS_SIZE;
+    return buf;
+}
+
+/* Little-endian records of a counter, a timestamp, a few flags and a value
+ * drawn from a small set, like the rows of a telemetry stream */
+static unsigned char *generate_records(size_t *size) {
+    unsigned char *buf = (unsigned char *)malloc(CORPUS_SIZE);
+    uint32_t seed = 1, id = 0, time = 1600000000, r;
+    size_t pos, i;
+
+    if (buf == NULL)
+        exit(1);
+    for (pos = 0; pos + 16 <= CORPUS_SIZE; pos += 16, id++) {
+        r = test_rand(&seed);
+        time += (r >> 12);
+        for (i = 0; i < 4; i++) {
+            buf[pos + i] = (unsigned char)(id >> (8 * i));
+            buf[pos + 4 + i] = (unsigned char)(time >> (8 * i));
+        }
+        buf[pos + 8] = (unsigned char)(r & 0x7);
+        buf[pos + 9] = 0;
+        buf[pos + 10] = (unsigned char)(r >> 4);
+        buf[pos + 11] = 0;
+        for (i = 0; i < 4; i++)
+            buf[pos + 12 + i] = (unsigned char)((1000u << ((r >> 8) % 4)) >> (8 * i));
+    }
+    memset(buf + pos, 0, CORPUS_SIZE - pos);
+    *size = CORPUS_SIZE;
+    return buf;
+}
+
+static void benchmark(const char *name, unsigned char *in, size_t in_size) {
+    static const int levels[] = { 2, 6 };
+    static const uint32_t block_sizes[] = { 256, 1024, 4096 };
+    unsigned char *out;
+    size_t out_size;
+    unsigned l, b, run;
+
+    out_size = 2 * in_size + 1024;
+    out = (unsigned char *)malloc(out_size);
+    if (out == NULL)
+        exit(1);
+
+    printf("%s: %zu bytes of input\n", name, in_size);
+    for (l = 0; l <= sizeof(levels) / sizeof(levels[0]); l++) {
+        /* The last round is Huffman only, at the level of the first */
+        int level = l < sizeof(levels) / sizeof(levels[0]) ? levels[l] : levels[0];
+        int strategy = l < sizeof(levels) / sizeof(levels[0]) ? Z_DEFAULT_STRATEGY : Z_HUFFMAN_ONLY;
+
+        for (b = 0; b < sizeof(block_sizes) / sizeof(block_sizes[0]); b++) {
+            uint32_t block_size = block_sizes[b];
+            size_t blocks = (in_size + block_size - 1) / block_size;
+            size_t compressed = 0;
+            double best = 0;
+
+            for (run = 0; run < RUNS; run++) {
+                PREFIX3(stream) strm;
+                double start, elapsed;
+                size_t pos;
+
+                memset(&strm, 0, sizeof(strm));
+                if (PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, -15, 8, strategy) != Z_OK)
+                    exit(1);
+                strm.next_out = out;
+                strm.avail_out = (uint32_t)out_size;
+                start = now();
+                for (pos = 0; pos < in_size; pos += block_size) {
+                    strm.next_in = in + pos;
+                    strm.avail_in = (uint32_t)MIN(block_size, in_size - pos);
+                    if (PREFIX(deflate)(&strm, Z_SYNC_FLUSH) != Z_OK)
+                        exit(1);
+                }
+                elapsed = now() - start;
+                compressed = strm.total_out;
+                PREFIX(deflateEnd)(&strm);
+                if (run == 0 || elapsed < best)
+                    best = elapsed;
+            }
+            printf("%-8s level %d block %4u %10zu bytes %6.2f%% %8.1f ns/block %8.1f MB/s\n",
+                   strategy == Z_HUFFMAN_ONLY ? "huffman" : "default", level, block_size, compressed,
+                   100.0 * compressed / in_size, best / blocks, in_size / best * 1e3);
+        }
+    }
+    free(out);
+}
+
+int main(int argc, char **argv) {
+    unsigned char *in;
+    size_t in_size;
+    int i;
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++) {
+            in = read_file(argv[i], &in_size);
+            benchmark(argv[i], in, in_size);
+            free(in);
+        }
+    } else {
+        in = generate_text(&in_size);
+        benchmark("text", in, in_size);
+        free(in);
+        in = generate_records(&in_size);
+        benchmark("records", in, in_size);
+        free(in);
+    }
+    return 0;
+}
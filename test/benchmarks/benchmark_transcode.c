@@ -0,0 +1,96 @@
+/* benchmark_transcode.c -- compare zng_transcode() with inflate() and deflate()
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Compresses each file given on the command line, or generated text and binary
+ * records, at levels 1, 6 and 9, recompresses each of those at the other two
+ * levels once with zng_transcode() and once with zng_uncompress() and
+ * zng_compress2(), and reports the compressed size and the best speed out of a
+ * few runs, counted in bytes of uncompressed input.
+ */
+
+#define _POSIX_C_SOURCE 200112  /* For clock_gettime(). */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "benchmark_shared.h"
+
+#define RUNS          5
+#define CORPUS_SIZE   (8 * 1024 * 1024)
+
+static void benchmark(const char *name, unsigned char *in, size_t in_size) {
+    static const int levels[] = { 1, 6, 9 };
+    unsigned char *source, *out, *uncompr;
+    size_t out_size, source_len, out_len, used, uncompr_len;
+    unsigned from, to, run;
+
+    out_size = (size_t)zng_compressBound((unsigned long)in_size);
+    source = (unsigned char *)malloc(out_size);
+    out = (unsigned char *)malloc(out_size);
+    uncompr = (unsigned char *)malloc(in_size);
+    if (source == NULL || out == NULL || uncompr == NULL)
+        exit(1);
+
+    printf("%s: %zu bytes of input\n", name, in_size);
+    for (from = 0; from < sizeof(levels) / sizeof(levels[0]); from++) {
+        source_len = out_size;
+        if (zng_compress2(source, &source_len, in, in_size, levels[from]) != Z_OK)
+            exit(1);
+        for (to = 0; to < sizeof(levels) / sizeof(levels[0]); to++) {
+            double best = 0, best_again = 0, start, elapsed;
+            size_t transcoded = 0, again = 0;
+
+            if (to == from)
+                continue;
+            for (run = 0; run < RUNS; run++) {
+                start = now();
+                out_len = out_size;
+                used = source_len;
+                if (zng_transcode(out, &out_len, source, &used, levels[to], 15) != Z_OK)
+                    exit(1);
+                elapsed = now() - start;
+                transcoded = out_len;
+                if (run == 0 || elapsed < best)
+                    best = elapsed;
+
+                start = now();
+                uncompr_len = in_size;
+                out_len = out_size;
+                if (zng_uncompress(uncompr, &uncompr_len, source, source_len) != Z_OK ||
+                    zng_compress2(out, &out_len, uncompr, uncompr_len, levels[to]) != Z_OK)
+                    exit(1);
+                elapsed = now() - start;
+                again = out_len;
+                if (run == 0 || elapsed < best_again)
+                    best_again = elapsed;
+            }
+            printf("level %d to %d transcode %10zu bytes %8.1f MB/s, inflate and deflate %10zu bytes %8.1f MB/s\n",
+                   levels[from], levels[to], transcoded, in_size / best * 1e3, again, in_size / best_again * 1e3);
+        }
+    }
+    free(uncompr);
+    free(out);
+    free(source);
+}
+
+int main(int argc, char **argv) {
+    unsigned char *in;
+    size_t in_size;
+    int i;
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++) {
+            in = read_file(argv[i], &in_size);
+            benchmark(argv[i], in, in_size);
+            free(in);
+        }
+    } else {
+        in = generate_mixed(CORPUS_SIZE, CORPUS_SIZE, "t");
+        benchmark("text", in, CORPUS_SIZE);
+        free(in);
+        in = generate_mixed(CORPUS_SIZE, CORPUS_SIZE, "b");
+        benchmark("records", in, CORPUS_SIZE);
+        free(in);
+    }
+    return 0;
+}
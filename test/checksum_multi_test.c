@@ -0,0 +1,59 @@
+/* checksum_multi_test.c -- unit test for the multi-buffer checksum functions
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BUF_SIZE   (64 * 1024)
+#define MAX_BUFS   257
+
+static void check(const char *what, size_t index, const zng_checksum_buf *job, uint32_t expect) {
+    if (job->result != expect) {
+        fprintf(stderr, "FAIL: %s buffer %zu of %zu bytes returned 0x%08x expected 0x%08x\n",
+                what, index, job->len, job->result, expect);
+        exit(1);
+    }
+}
+
+int main(void) {
+    static zng_checksum_buf bufs[MAX_BUFS];
+    uint8_t *data;
+    size_t count, i, offset;
+    uint32_t rnd = 1;
+
+    data = (uint8_t *)malloc(BUF_SIZE);
+    if (data == NULL)
+        return EXIT_FAILURE;
+    for (i = 0; i < BUF_SIZE; i++)
+        data[i] = (uint8_t)((i * 2654435761u) >> 11);
+
+    /* Every count from empty to more than a multiple of the lane count, with
+     * lengths from zero up to several NMAX blocks, and an occasional NULL */
+    for (count = 0; count <= MAX_BUFS; count += (count < 16 ? 1 : 37)) {
+        for (i = 0; i < count; i++) {
+            rnd = rnd * 1103515245 + 12345;
+            offset = (rnd >> 8) % 64;
+            bufs[i].buf = (i % 29 == 28) ? NULL : data + offset;
+            bufs[i].len = (i % 7 == 6) ? (rnd >> 4) % (BUF_SIZE - 64) : (rnd >> 16) % 600;
+            bufs[i].seed = rnd;
+        }
+
+        zng_crc32_multi(bufs, count);
+        for (i = 0; i < count; i++)
+            check("crc32_multi", i, &bufs[i], zng_crc32_z(bufs[i].seed, bufs[i].buf, bufs[i].len));
+
+        for (i = 0; i < count; i++)
+            bufs[i].seed = (bufs[i].seed % 65521) | ((bufs[i].seed >> 16) % 65521) << 16;
+        zng_adler32_multi(bufs, count);
+        for (i = 0; i < count; i++)
+            check("adler32_multi", i, &bufs[i], zng_adler32_z(bufs[i].seed, bufs[i].buf, bufs[i].len));
+    }
+
+    free(data);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,81 @@
+/* checksum_parallel_test.c -- unit test for the parallel checksum functions
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BUF_SIZE (1024 * 1024 + 3)
+
+static size_t tasks_run;
+
+/* Runs the tasks on the calling thread, last one first, to check that the
+ * result does not depend on the order in which the slices complete */
+static int32_t run_reversed(void *opaque, zng_task_func task, void *task_arg, size_t count) {
+    Z_UNUSED(opaque);
+    while (count > 0) {
+        task(task_arg, --count);
+        tasks_run++;
+    }
+    return Z_OK;
+}
+
+static int32_t run_refused(void *opaque, zng_task_func task, void *task_arg, size_t count) {
+    Z_UNUSED(opaque);
+    Z_UNUSED(task);
+    Z_UNUSED(task_arg);
+    Z_UNUSED(count);
+    return Z_MEM_ERROR;
+}
+
+static void check(const char *what, uint32_t got, uint32_t expect, size_t max_tasks, size_t len) {
+    if (got != expect) {
+        fprintf(stderr, "FAIL: %s with %zu tasks over %zu bytes returned 0x%08x expected 0x%08x\n",
+                what, max_tasks, len, got, expect);
+        exit(1);
+    }
+}
+
+int main(void) {
+    static const size_t lens[] = { 0, 1, 4095, 4096, 65537, BUF_SIZE };
+    zng_executor executor;
+    uint8_t *buf;
+    size_t i, j, max_tasks;
+
+    buf = (uint8_t *)malloc(BUF_SIZE);
+    if (buf == NULL)
+        return EXIT_FAILURE;
+    for (i = 0; i < BUF_SIZE; i++)
+        buf[i] = (uint8_t)((i * 2654435761u) >> 13);
+
+    memset(&executor, 0, sizeof(executor));
+    executor.run = run_reversed;
+    executor.min_task_size = 4096;
+
+    for (max_tasks = 0; max_tasks <= 70; max_tasks += 7) {
+        executor.max_tasks = max_tasks;
+        for (j = 0; j < sizeof(lens) / sizeof(lens[0]); j++) {
+            check("crc32_parallel", zng_crc32_parallel(0x1234, buf, lens[j], &executor),
+                  zng_crc32_z(0x1234, buf, lens[j]), max_tasks, lens[j]);
+            check("adler32_parallel", zng_adler32_parallel(0x56780001, buf, lens[j], &executor),
+                  zng_adler32_z(0x56780001, buf, lens[j]), max_tasks, lens[j]);
+        }
+    }
+    if (tasks_run == 0) {
+        fprintf(stderr, "FAIL: executor was never used\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Falls back to the calling thread without an executor or when it refuses the work */
+    check("crc32_parallel", zng_crc32_parallel(0, buf, BUF_SIZE, NULL), zng_crc32_z(0, buf, BUF_SIZE), 0, BUF_SIZE);
+    executor.run = run_refused;
+    executor.max_tasks = 8;
+    check("adler32_parallel", zng_adler32_parallel(1, buf, BUF_SIZE, &executor), zng_adler32_z(1, buf, BUF_SIZE), 8, BUF_SIZE);
+
+    free(buf);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,103 @@
+/* crc32_test.c -- unit test for crc32 in the zlib compression library
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+typedef struct {
+    uint32_t line;
+    uint32_t crc;
+    const uint8_t *buf;
+    uint32_t len;
+    uint32_t expect;
+} crc32_test;
+
+void test_crc32(uint32_t crc, const uint8_t *buf, uint32_t len, uint32_t chk, uint32_t line) {
+    uint32_t res = (uint32_t)PREFIX(crc32)(crc, buf, len);
+    if (res != chk) {
+        fprintf(stderr, "FAIL [%d]: crc32 returned 0x%08X expected 0x%08X\n",
+                line, res, chk);
+        exit(1);
+    }
+}
+
+/* Bit-at-a-time reference used to check every length and alignment */
+static uint32_t crc32_bitwise(uint32_t crc, const uint8_t *buf, uint32_t len) {
+    int k;
+
+    crc = ~crc;
+    while (len--) {
+        crc ^= *buf++;
+        for (k = 0; k < 8; k++)
+            crc = crc & 1 ? (crc >> 1) ^ 0xedb88320 : crc >> 1;
+    }
+    return ~crc;
+}
+
+static const crc32_test tests[] = {
+   {__LINE__, 0x0, (const uint8_t *)0x0, 0, 0x0},
+   {__LINE__, 0x0, (const uint8_t *)"", 0, 0x0},
+   {__LINE__, 0x0, (const uint8_t *)"a", 1, 0xe8b7be43},
+   {__LINE__, 0x0, (const uint8_t *)"abacus", 6, 0xc3d7115b},
+   {__LINE__, 0x0, (const uint8_t *)"backlog", 7, 0x269205},
+   {__LINE__, 0x0, (const uint8_t *)"campfire", 8, 0x22a515f8},
+   {__LINE__, 0x0, (const uint8_t *)"delta", 5, 0x9643fed9},
+   {__LINE__, 0x0, (const uint8_t *)"executable", 10, 0xd68eda01},
+   {__LINE__, 0x0, (const uint8_t *)"file", 4, 0x8c9f3610},
+   {__LINE__, 0x0, (const uint8_t *)"greatest", 8, 0xc1abd6cd},
+   {__LINE__, 0x0, (const uint8_t *)"hello", 5, 0x3610a686},
+   {__LINE__, 0x0, (const uint8_t *)"inverter", 8, 0xc9e962c9},
+   {__LINE__, 0x0, (const uint8_t *)"jigsaw", 6, 0xce4e3f69},
+   {__LINE__, 0x0, (const uint8_t *)"karate", 6, 0x890be0e2},
+   {__LINE__, 0x0, (const uint8_t *)"landscape", 9, 0xc4e0330b},
+   {__LINE__, 0x0, (const uint8_t *)"machine", 7, 0x1505df84},
+   {__LINE__, 0x0, (const uint8_t *)"nanometer", 9, 0xd4e19f39},
+   {__LINE__, 0x0, (const uint8_t *)"oblivion", 8, 0xdae9de77},
+   {__LINE__, 0x0, (const uint8_t *)"panama", 6, 0x66b8979c},
+   {__LINE__, 0x0, (const uint8_t *)"quest", 5, 0x4317f817},
+   {__LINE__, 0x0, (const uint8_t *)"ridiculous", 10, 0xbd14d683},
+   {__LINE__, 0x0, (const uint8_t *)"secret", 6, 0x5ca2e8e5},
+   {__LINE__, 0x0, (const uint8_t *)"ultimate", 8, 0x3fc79b0b},
+   {__LINE__, 0x0, (const uint8_t *)"vector", 6, 0x1b6e485b},
+   {__LINE__, 0x0, (const uint8_t *)"walrus", 6, 0xbe769b97},
+   {__LINE__, 0x0, (const uint8_t *)"xeno", 4, 0xe7a06444},
+   {__LINE__, 0x0, (const uint8_t *)"yelling", 7, 0xfe3944e5},
+   {__LINE__, 0x0, (const uint8_t *)"zlib", 4, 0x73887d3a},
+   {__LINE__, 0x0, (const uint8_t *)"123456789", 9, 0xcbf43926},
+   {__LINE__, 0x0, (const uint8_t *)"The quick brown fox jumps over the lazy dog", 43, 0x414fa339},
+   {__LINE__, 0x0, (const uint8_t *)"The quick brown fox jumps over the lazy dog, and then the quick brown fox jumps over it again, and again", 104, 0x2fc6f10d},
+   {__LINE__, 0xffffffff, (const uint8_t *)"The quick brown fox jumps over the lazy dog", 43, 0x4639f7f7},
+   {__LINE__, 0x7a30360d, (const uint8_t *)"The quick brown fox jumps over the lazy dog", 43, 0x62fd7201},
+};
+
+static const int test_size = sizeof(tests) / sizeof(crc32_test);
+
+int main(void) {
+    uint8_t buf[1024 + 8];
+    uint32_t offset, len;
+    int i;
+
+    for (i = 0; i < test_size; i++) {
+        test_crc32(tests[i].crc, tests[i].buf, tests[i].len, tests[i].expect, tests[i].line);
+    }
+
+    /* Exercise the head, braided body and tail of every length and alignment */
+    for (i = 0; i < (int)sizeof(buf); i++)
+        buf[i] = (uint8_t)(i * 251 + (i >> 3));
+    for (offset = 0; offset < 8; offset++) {
+        for (len = 0; len <= 1024; len++) {
+            test_crc32(0x12345678, buf + offset, len, crc32_bitwise(0x12345678, buf + offset, len), __LINE__);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+/* Test that Z_ADAPTIVE round trips input that switches between text, runs and
+ * random data, when fed and drained in small pieces.
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "test_shared.h"
+
+#define ADAPTIVE_SIZE    (1024 * 1024)
+#define ADAPTIVE_SEGMENT 65536
+#define ADAPTIVE_CHUNK   4093
+
+static unsigned char next_in[ADAPTIVE_SIZE];
+static unsigned char next_out[ADAPTIVE_SIZE * 2];
+
+static uint32_t compress_adaptive(int level, int strategy) {
+    zng_stream strm;
+    uint32_t left = ADAPTIVE_SIZE, out_len;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = zng_deflateInit2(&strm, level, Z_DEFLATED, -15, 8, strategy);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    strm.next_in = next_in;
+    strm.next_out = next_out;
+    do {
+        strm.avail_in = MIN(left, ADAPTIVE_CHUNK);
+        left -= strm.avail_in;
+        do {
+            out_len = (uint32_t)(sizeof(next_out) - strm.total_out);
+            strm.avail_out = MIN(out_len, ADAPTIVE_CHUNK);
+            ret = zng_deflate(&strm, left ? Z_NO_FLUSH : Z_FINISH);
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+                fprintf(stderr, "deflate() failed with code %d\n", ret);
+                exit(EXIT_FAILURE);
+            }
+        } while (strm.avail_out == 0);
+    } while (left);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() did not finish at level %d\n", level);
+        exit(EXIT_FAILURE);
+    }
+    out_len = (uint32_t)strm.total_out;
+    zng_deflateEnd(&strm);
+    return out_len;
+}
+
+int main() {
+    uint32_t seed = 1, adaptive_size, default_size;
+    int level;
+
+    /* Alternate between text, runs of short periods and random bytes */
+    test_fill_mixed(next_in, ADAPTIVE_SIZE, ADAPTIVE_SEGMENT, "trx", &seed);
+
+    for (level = 1; level <= 9; level++) {
+        adaptive_size = compress_adaptive(level, Z_ADAPTIVE);
+        test_inflate_check(next_out, adaptive_size, -15, next_in, ADAPTIVE_SIZE, "at level %d", level);
+
+        /* The random third dominates the size, leave some room for the rest */
+        default_size = compress_adaptive(level, Z_DEFAULT_STRATEGY);
+        if (adaptive_size > default_size + default_size / 16) {
+            fprintf(stderr, "level %d compressed to %u bytes, %u without Z_ADAPTIVE\n",
+                    level, adaptive_size, default_size);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
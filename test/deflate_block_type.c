@@ -0,0 +1,109 @@
+/* Test that deflate chooses the type of its blocks by their length: stored
+ * blocks for random bytes, static trees for a short message and dynamic trees
+ * for larger compressible blocks, and that Z_FIXED only stores a block when
+ * the dynamic trees would not compress it either.
+ */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "test_shared.h"
+
+#define BLOCK_TYPE_SIZE (64 * 1024)
+
+static unsigned char next_in[BLOCK_TYPE_SIZE];
+static unsigned char next_out[BLOCK_TYPE_SIZE * 2];
+
+/* Add up the bytes sent in stored, static and dynamic blocks by the raw
+ * deflate stream at compr in bytes[0] to bytes[2], reading the header of each
+ * block at the bit where inflate() with Z_BLOCK stopped after the previous one */
+static void count_bytes(const unsigned char *compr, size_t compr_len, size_t expect_len, size_t bytes[3]) {
+    PREFIX3(stream) strm;
+    unsigned char *out = (unsigned char *)malloc(expect_len + 1);
+    size_t bit = 0, total_out;
+    int ret, last, type;
+
+    memset(&strm, 0, sizeof(strm));
+    if (out == NULL || PREFIX(inflateInit2)(&strm, -15) != Z_OK) {
+        fprintf(stderr, "inflateInit2() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    bytes[0] = bytes[1] = bytes[2] = 0;
+    strm.next_in = (unsigned char *)compr;
+    strm.avail_in = (uint32_t)compr_len;
+    strm.next_out = out;
+    strm.avail_out = (uint32_t)expect_len + 1;
+    do {
+        /* BFINAL, then the two bits of BTYPE */
+        last = (compr[bit / 8] >> (bit % 8)) & 1;
+        type = (compr[(bit + 1) / 8] >> ((bit + 1) % 8)) & 1;
+        type |= ((compr[(bit + 2) / 8] >> ((bit + 2) % 8)) & 1) << 1;
+        if (type == 3) {
+            fprintf(stderr, "invalid block type at bit %zu\n", bit);
+            exit(EXIT_FAILURE);
+        }
+        /* Run to the end of the block */
+        total_out = (size_t)strm.total_out;
+        do {
+            ret = PREFIX(inflate)(&strm, Z_BLOCK);
+        } while (ret == Z_OK && !(strm.data_type & 128));
+        bytes[type] += (size_t)strm.total_out - total_out;
+        bit = (size_t)strm.total_in * 8 - (size_t)(strm.data_type & 7);
+    } while (ret == Z_OK && !last);
+    if (ret == Z_OK)
+        ret = PREFIX(inflate)(&strm, Z_FINISH);
+    if (ret != Z_STREAM_END || strm.total_out != expect_len) {
+        fprintf(stderr, "inflate() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    PREFIX(inflateEnd)(&strm);
+    free(out);
+}
+
+/* Compress len bytes of next_in and check that all but the last percent of
+ * them, which may end in a small block of another type, are sent in blocks of
+ * the expected type */
+static void check_type(size_t len, int level, int strategy, int expect_type, const char *what) {
+    size_t bytes[3], compr_len;
+
+    compr_len = test_deflate(next_in, len, next_out, sizeof(next_out), level, -15, 8, strategy, (uint32_t)len,
+                             Z_NO_FLUSH);
+    test_inflate_check(next_out, compr_len, -15, next_in, len, "%s at level %d", what, level);
+    count_bytes(next_out, compr_len, len, bytes);
+    if (bytes[expect_type] < len - len / 100) {
+        fprintf(stderr, "%s at level %d with strategy %d: %zu stored, %zu static and %zu dynamic bytes\n", what,
+                level, strategy, bytes[0], bytes[1], bytes[2]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+int main() {
+    uint32_t seed = 1;
+    size_t pos;
+    int level;
+
+    /* Level 1 sends static blocks of its own */
+    for (level = 2; level <= 9; level++) {
+        test_fill_random(next_in, BLOCK_TYPE_SIZE, &seed);
+        check_type(BLOCK_TYPE_SIZE, level, Z_DEFAULT_STRATEGY, 0, "random bytes");
+
+        test_fill_text(next_in, BLOCK_TYPE_SIZE, &seed);
+        check_type(BLOCK_TYPE_SIZE, level, Z_DEFAULT_STRATEGY, 2, "text");
+        check_type(40, level, Z_DEFAULT_STRATEGY, 1, "a short message");
+
+        /* Bytes of 16 values that have 9 bit static codes, which the static
+         * trees expand and the dynamic trees compress to half */
+        for (pos = 0; pos < BLOCK_TYPE_SIZE; pos++)
+            next_in[pos] = (unsigned char)(0xf0 + test_rand(&seed) % 16);
+        check_type(4096, level, Z_DEFAULT_STRATEGY, 2, "bytes of 16 values");
+        check_type(4096, level, Z_FIXED, 1, "bytes of 16 values");
+
+        test_fill_random(next_in, BLOCK_TYPE_SIZE, &seed);
+        check_type(4096, level, Z_FIXED, 0, "random bytes");
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,188 @@
+/* Test that a dictionary created once with zng_deflateDictionaryCreate() gives
+ * the same output as deflateSetDictionary() for every stream that uses it,
+ * whether it takes the hash tables as they are or hashes the dictionary again.
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "test_shared.h"
+
+#define DICT_SIZE     40000
+#define MESSAGE_SIZE  1500
+#define MESSAGES      8
+
+static unsigned char dictionary[DICT_SIZE];
+static unsigned char message[MESSAGE_SIZE];
+static unsigned char expected[MESSAGE_SIZE * 2];
+static unsigned char compr[MESSAGE_SIZE * 2];
+static unsigned char uncompr[MESSAGE_SIZE];
+
+static void init_stream(zng_stream *strm, int level, int window_bits, int hash_len) {
+    zng_deflate_param_value param;
+    int ret;
+
+    memset(strm, 0, sizeof(*strm));
+    ret = zng_deflateInit2(strm, level, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    param.param = Z_DEFLATE_HASH_LENGTH;
+    param.buf = &hash_len;
+    param.size = sizeof(hash_len);
+    if (zng_deflateSetParams(strm, &param, 1) != Z_OK) {
+        fprintf(stderr, "cannot set hash length %d\n", hash_len);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static uint32_t compress_message(zng_stream *strm, unsigned char *out) {
+    int ret;
+
+    strm->next_in = message;
+    strm->avail_in = MESSAGE_SIZE;
+    strm->next_out = out;
+    strm->avail_out = MESSAGE_SIZE * 2;
+    ret = zng_deflate(strm, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    return (uint32_t)strm->total_out;
+}
+
+static void inflate_check(uint32_t compr_len, int window_bits) {
+    zng_stream strm;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    if (zng_inflateInit2(&strm, window_bits) != Z_OK) {
+        fprintf(stderr, "inflateInit2() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    if (window_bits < 0)
+        zng_inflateSetDictionary(&strm, dictionary, DICT_SIZE);
+    strm.next_in = compr;
+    strm.avail_in = compr_len;
+    strm.next_out = uncompr;
+    strm.avail_out = sizeof(uncompr);
+    ret = zng_inflate(&strm, Z_FINISH);
+    if (ret == Z_NEED_DICT) {
+        if (zng_inflateSetDictionary(&strm, dictionary, DICT_SIZE) != Z_OK) {
+            fprintf(stderr, "dictionary of the zlib stream does not match\n");
+            exit(EXIT_FAILURE);
+        }
+        ret = zng_inflate(&strm, Z_FINISH);
+    }
+    if (ret != Z_STREAM_END || strm.total_out != MESSAGE_SIZE || memcmp(uncompr, message, MESSAGE_SIZE) != 0) {
+        fprintf(stderr, "inflated message does not match with windowBits %d\n", window_bits);
+        exit(EXIT_FAILURE);
+    }
+    zng_inflateEnd(&strm);
+}
+
+/* Compress messages with the dictionary created at create_level with create_bits, by a stream at level */
+static void check_dictionary(int create_level, int create_bits, int level, int window_bits, int hash_len) {
+    zng_deflate_dictionary *dict;
+    zng_stream create, set, use;
+    uint32_t seed = 7, expected_len, compr_len, i, j;
+
+    init_stream(&create, create_level, create_bits, hash_len);
+    dict = zng_deflateDictionaryCreate(&create, dictionary, DICT_SIZE);
+    if (dict == NULL) {
+        fprintf(stderr, "deflateDictionaryCreate() failed at level %d\n", create_level);
+        exit(EXIT_FAILURE);
+    }
+    if (zng_deflateDictionaryCreate(&create, dictionary, DICT_SIZE) != NULL) {
+        fprintf(stderr, "deflateDictionaryCreate() took a stream with a dictionary\n");
+        exit(EXIT_FAILURE);
+    }
+    zng_deflateEnd(&create);
+
+    init_stream(&set, level, window_bits, hash_len);
+    init_stream(&use, level, window_bits, hash_len);
+    for (i = 0; i < MESSAGES; i++) {
+        /* Messages made of pieces of the dictionary and a few random bytes */
+        for (j = 0; j < MESSAGE_SIZE; j++) {
+            if (test_rand(&seed) % 16 == 0)
+                message[j] = (unsigned char)test_rand(&seed);
+            else
+                message[j] = dictionary[(test_rand(&seed) % 64) * 600 + j];
+        }
+        /* and the last bytes of the dictionary followed by the start of the message. The
+         * last positions of the dictionary are hashed with the bytes after it in the window,
+         * the start of the previous message, which is the same for all of them */
+        message[0] = 'a';
+        message[MESSAGE_SIZE / 2 - 1] = 0;
+        memcpy(message + MESSAGE_SIZE / 2, dictionary + DICT_SIZE - 5, 5);
+        memcpy(message + MESSAGE_SIZE / 2 + 5, message, 64);
+        zng_deflateReset(&set);
+        zng_deflateReset(&use);
+        if (zng_deflateSetDictionary(&set, dictionary, DICT_SIZE) != Z_OK ||
+            zng_deflateUseDictionary(&use, dict) != Z_OK || set.adler != use.adler) {
+            fprintf(stderr, "deflateUseDictionary() failed at level %d\n", level);
+            exit(EXIT_FAILURE);
+        }
+        expected_len = compress_message(&set, expected);
+        compr_len = compress_message(&use, compr);
+        if (compr_len != expected_len || memcmp(compr, expected, compr_len) != 0) {
+            fprintf(stderr, "output differs from deflateSetDictionary() at level %d from level %d with "
+                    "windowBits %d from %d and hash length %d\n", level, create_level, window_bits, create_bits,
+                    hash_len);
+            exit(EXIT_FAILURE);
+        }
+        inflate_check(compr_len, window_bits);
+    }
+    zng_deflateEnd(&set);
+    zng_deflateEnd(&use);
+    zng_deflateDictionaryFree(dict);
+}
+
+int main() {
+    static const int window_bits[] = { -15, 15, -12, 12 };
+    zng_deflate_dictionary *dict;
+    zng_stream strm;
+    uint32_t seed = 1, i;
+    int level;
+
+    for (i = 0; i < DICT_SIZE; i++)
+        dictionary[i] = (unsigned char)('a' + test_rand(&seed) % 20);
+
+    for (i = 0; i < sizeof(window_bits) / sizeof(window_bits[0]); i++) {
+        for (level = 0; level <= 9; level++) {
+            check_dictionary(level, window_bits[i], level, window_bits[i], 4);
+            /* Hashed differently, the dictionary is hashed again */
+            check_dictionary(9 - level, window_bits[i], level, window_bits[i], 4);
+        }
+        check_dictionary(6, window_bits[i], 6, window_bits[i], 6);
+        /* With another window, the dictionary is hashed again, as far back as the window of the stream goes */
+        check_dictionary(6, window_bits[i] < 0 ? -9 : 9, 6, window_bits[i], 4);
+        check_dictionary(6, window_bits[i] < 0 ? -15 : 15, 6, window_bits[i], 4);
+    }
+
+    /* gzip streams take no dictionary, nor zlib streams that started */
+    init_stream(&strm, 6, 15, 4);
+    dict = zng_deflateDictionaryCreate(&strm, dictionary, DICT_SIZE);
+    zng_deflateEnd(&strm);
+    init_stream(&strm, 6, 31, 4);
+    if (dict == NULL || zng_deflateUseDictionary(&strm, dict) != Z_STREAM_ERROR ||
+        zng_deflateDictionaryCreate(&strm, dictionary, DICT_SIZE) != NULL) {
+        fprintf(stderr, "gzip stream took a dictionary\n");
+        return EXIT_FAILURE;
+    }
+    zng_deflateEnd(&strm);
+    init_stream(&strm, 6, 15, 4);
+    strm.next_in = message;
+    strm.avail_in = 100;
+    strm.next_out = compr;
+    strm.avail_out = sizeof(compr);
+    if (zng_deflate(&strm, Z_NO_FLUSH) != Z_OK || zng_deflateUseDictionary(&strm, dict) != Z_STREAM_ERROR ||
+        zng_deflateUseDictionary(&strm, NULL) != Z_STREAM_ERROR) {
+        fprintf(stderr, "started zlib stream took a dictionary\n");
+        return EXIT_FAILURE;
+    }
+    zng_deflateEnd(&strm);
+    zng_deflateDictionaryFree(dict);
+    return EXIT_SUCCESS;
+}
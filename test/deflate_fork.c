@@ -0,0 +1,189 @@
+/* Test that a stream forked with zng_deflateFork() continues exactly like a
+ * deflateCopy() of it, whether the fork allocates its memory or reuses that
+ * of a stream forked before, whatever the source did before the fork, and
+ * whichever of the streams that share the hash table goes on first.
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "test_shared.h"
+
+#define FORK_SIZE     (256 * 1024)
+#define FORK_SEGMENT  16384
+
+static unsigned char next_in[FORK_SIZE];
+static unsigned char prefix[FORK_SIZE * 2];
+static unsigned char expected[FORK_SIZE * 2];
+static unsigned char forked[FORK_SIZE * 2];
+
+/* Compress the rest of the input after a level change, and return the bytes written */
+static size_t finish(zng_stream *strm, uint32_t at, int level, unsigned char *out) {
+    int ret;
+
+    strm->next_out = out;
+    strm->avail_out = FORK_SIZE * 2;
+    strm->avail_in = 0;
+    if (zng_deflateParams(strm, level, Z_DEFAULT_STRATEGY) != Z_OK) {
+        fprintf(stderr, "deflateParams() failed after the fork\n");
+        exit(EXIT_FAILURE);
+    }
+    strm->next_in = next_in + at;
+    strm->avail_in = FORK_SIZE - at;
+    ret = zng_deflate(strm, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() failed with code %d after the fork\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    return (size_t)(strm->next_out - out);
+}
+
+/* Compress the first at bytes at level, switching to switch_level halfway, leaving up to out_room
+ * bytes of output pending, then fork into fork and continue it and a deflateCopy() at level to.
+ * The source goes on at another level before them if source_first is set, and at level to after
+ * them otherwise. */
+static void check_fork(zng_stream *fork, int level, int switch_level, int window_bits, int mem_level, uint32_t at,
+                       uint32_t out_room, int to, int source_first) {
+    zng_stream strm, copy;
+    size_t prefix_len, expected_len, forked_len;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = zng_deflateInit2(&strm, level, Z_DEFLATED, window_bits, mem_level, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    strm.next_out = prefix;
+    strm.avail_out = sizeof(prefix);
+    strm.next_in = next_in;
+    strm.avail_in = at / 2;
+    if (zng_deflate(&strm, Z_NO_FLUSH) != Z_OK || zng_deflateParams(&strm, switch_level, Z_DEFAULT_STRATEGY) != Z_OK) {
+        fprintf(stderr, "deflate() failed before the fork\n");
+        exit(EXIT_FAILURE);
+    }
+    /* Leave output pending when out_room is smaller than what the rest makes */
+    strm.avail_in = at - at / 2;
+    strm.avail_out = MIN(out_room, (uint32_t)(prefix + sizeof(prefix) - strm.next_out));
+    ret = zng_deflate(&strm, Z_PARTIAL_FLUSH);
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+        fprintf(stderr, "deflate() failed with code %d before the fork\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    prefix_len = (size_t)(strm.next_out - prefix);
+    /* Without the room to write it out, deflate() stops before taking all of the input */
+    at = (uint32_t)(strm.next_in - next_in);
+
+    if (zng_deflateCopy(&copy, &strm) != Z_OK || zng_deflateFork(fork, &strm) != Z_OK) {
+        fprintf(stderr, "deflateFork() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    /* The source goes on differently, and must not disturb the fork */
+    if (source_first) {
+        finish(&strm, at, 9 - to, expected);
+        zng_deflateEnd(&strm);
+    }
+
+    expected_len = finish(&copy, at, to, expected);
+    forked_len = finish(fork, at, to, forked);
+    if (forked_len != expected_len || memcmp(forked, expected, expected_len) != 0) {
+        fprintf(stderr, "fork differs from deflateCopy() at %u bytes from level %d and %d to %d with windowBits %d "
+                "and memLevel %d\n", at, level, switch_level, to, window_bits, mem_level);
+        exit(EXIT_FAILURE);
+    }
+    zng_deflateEnd(&copy);
+    memcpy(prefix + prefix_len, forked, forked_len);
+    test_inflate_check(prefix, prefix_len + forked_len, window_bits, next_in, FORK_SIZE, "fork with windowBits %d",
+                       window_bits);
+
+    /* nor the fork the source */
+    if (!source_first) {
+        if (finish(&strm, at, to, forked) != expected_len || memcmp(forked, expected, expected_len) != 0) {
+            fprintf(stderr, "source differs from deflateCopy() after the fork at %u bytes\n", at);
+            exit(EXIT_FAILURE);
+        }
+        zng_deflateEnd(&strm);
+    }
+}
+
+int main() {
+    static const int levels[][2] = { {1, 1}, {6, 6}, {9, 9}, {9, 1}, {1, 9}, {3, 6}, {0, 6} };
+    static const uint32_t fork_at[] = { 0, 100, 20000, 40000, 150000 };
+    static const int window_bits[] = { 15, -12, 31 };
+    zng_deflate_dictionary *dict;
+    zng_stream fork, strm, copy, forks[3];
+    size_t expected_len;
+    uint32_t seed = 1, at, i, j, k;
+
+    /* Alternate between text and binary records */
+    test_fill_mixed(next_in, FORK_SIZE, FORK_SEGMENT, "tb", &seed);
+
+    /* The same fork stream throughout, reused while the sizes stay the same */
+    memset(&fork, 0, sizeof(fork));
+    for (i = 0; i < sizeof(window_bits) / sizeof(window_bits[0]); i++) {
+        for (j = 0; j < sizeof(levels) / sizeof(levels[0]); j++) {
+            for (k = 0; k < sizeof(fork_at) / sizeof(fork_at[0]); k++) {
+                check_fork(&fork, levels[j][0], levels[j][1], window_bits[i], 8, fork_at[k], FORK_SIZE * 2, 6, 1);
+                check_fork(&fork, levels[j][0], levels[j][1], window_bits[i], 8, fork_at[k], 100, 1, 0);
+            }
+        }
+        check_fork(&fork, 6, 6, window_bits[i], 9, 50000, FORK_SIZE * 2, 9, 0);
+        check_fork(&fork, 6, 6, window_bits[i], 1, 50000, 10, 9, 1);
+    }
+    zng_deflateEnd(&fork);
+
+    /* Several forks sharing the hash table of a source that is ended first, one of them forked
+     * again while sharing it, and one forked from another fork */
+    memset(&strm, 0, sizeof(strm));
+    memset(forks, 0, sizeof(forks));
+    if (zng_deflateInit2(&strm, 6, Z_DEFLATED, 15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed\n");
+        return EXIT_FAILURE;
+    }
+    strm.next_in = next_in;
+    strm.avail_in = 50000;
+    strm.next_out = prefix;
+    strm.avail_out = sizeof(prefix);
+    if (zng_deflate(&strm, Z_NO_FLUSH) != Z_OK || zng_deflateCopy(&copy, &strm) != Z_OK ||
+        zng_deflateFork(&forks[0], &strm) != Z_OK || zng_deflateFork(&forks[1], &strm) != Z_OK ||
+        zng_deflateFork(&forks[0], &strm) != Z_OK || zng_deflateFork(&forks[2], &forks[1]) != Z_OK) {
+        fprintf(stderr, "deflateFork() of a fork failed\n");
+        return EXIT_FAILURE;
+    }
+    at = (uint32_t)(strm.next_in - next_in);
+    zng_deflateEnd(&strm);
+    expected_len = finish(&copy, at, 6, expected);
+    zng_deflateEnd(&copy);
+    for (i = 0; i < sizeof(forks) / sizeof(forks[0]); i++) {
+        if (finish(&forks[i], at, 6, forked) != expected_len || memcmp(forked, expected, expected_len) != 0) {
+            fprintf(stderr, "fork %u of the same source differs from deflateCopy()\n", i);
+            return EXIT_FAILURE;
+        }
+        zng_deflateEnd(&forks[i]);
+    }
+
+    /* Right after deflateUseDictionary(), before anything was written to the window */
+    memset(&strm, 0, sizeof(strm));
+    if (zng_deflateInit2(&strm, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK ||
+        (dict = zng_deflateDictionaryCreate(&strm, next_in, 30000)) == NULL) {
+        fprintf(stderr, "deflateDictionaryCreate() failed\n");
+        return EXIT_FAILURE;
+    }
+    zng_deflateReset(&strm);
+    memset(&fork, 0, sizeof(fork));
+    if (zng_deflateUseDictionary(&strm, dict) != Z_OK || zng_deflateCopy(&copy, &strm) != Z_OK ||
+        zng_deflateFork(&fork, &strm) != Z_OK || zng_deflateFork(&strm, &strm) != Z_STREAM_ERROR) {
+        fprintf(stderr, "deflateFork() after deflateUseDictionary() failed\n");
+        return EXIT_FAILURE;
+    }
+    expected_len = finish(&copy, 30000, 6, expected);
+    if (finish(&fork, 30000, 6, forked) != expected_len || memcmp(forked, expected, expected_len) != 0) {
+        fprintf(stderr, "fork differs from deflateCopy() after deflateUseDictionary()\n");
+        return EXIT_FAILURE;
+    }
+    zng_deflateEnd(&strm);
+    zng_deflateEnd(&copy);
+    zng_deflateEnd(&fork);
+    zng_deflateDictionaryFree(dict);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+/* Test that every Z_DEFLATE_HASH_LENGTH round trips at every level, also when
+ * changed in the middle of a stream, and that invalid lengths are refused.
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "test_shared.h"
+
+#define HASH_TEST_SIZE    (256 * 1024)
+#define HASH_TEST_SEGMENT 65536
+#define HASH_TEST_CHUNK   4093
+
+static unsigned char next_in[HASH_TEST_SIZE];
+static unsigned char next_out[HASH_TEST_SIZE * 2];
+
+static int set_hash_len(zng_stream *strm, int hash_len) {
+    zng_deflate_param_value param;
+
+    param.param = Z_DEFLATE_HASH_LENGTH;
+    param.buf = &hash_len;
+    param.size = sizeof(hash_len);
+    return zng_deflateSetParams(strm, &param, 1);
+}
+
+static int get_hash_len(zng_stream *strm) {
+    zng_deflate_param_value param;
+    int hash_len = -1;
+
+    param.param = Z_DEFLATE_HASH_LENGTH;
+    param.buf = &hash_len;
+    param.size = sizeof(hash_len);
+    if (zng_deflateGetParams(strm, &param, 1) != Z_OK) {
+        fprintf(stderr, "zng_deflateGetParams() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return hash_len;
+}
+
+/* Compress next_in with hash_len, switching to switch_len half way through */
+static uint32_t compress_hash_len(int level, int hash_len, int switch_len) {
+    zng_stream strm;
+    uint32_t left = HASH_TEST_SIZE, out_len;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = zng_deflateInit2(&strm, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    if (get_hash_len(&strm) != 4) {
+        fprintf(stderr, "hash length does not default to 4\n");
+        exit(EXIT_FAILURE);
+    }
+    if (set_hash_len(&strm, hash_len) != Z_OK || get_hash_len(&strm) != hash_len) {
+        fprintf(stderr, "cannot set hash length %d\n", hash_len);
+        exit(EXIT_FAILURE);
+    }
+    strm.next_in = next_in;
+    strm.next_out = next_out;
+    do {
+        strm.avail_in = MIN(left, HASH_TEST_CHUNK);
+        left -= strm.avail_in;
+        if (left < HASH_TEST_SIZE / 2 && left + strm.avail_in >= HASH_TEST_SIZE / 2) {
+            if (set_hash_len(&strm, switch_len) != Z_OK) {
+                fprintf(stderr, "cannot switch to hash length %d\n", switch_len);
+                exit(EXIT_FAILURE);
+            }
+        }
+        do {
+            out_len = (uint32_t)(sizeof(next_out) - strm.total_out);
+            strm.avail_out = MIN(out_len, HASH_TEST_CHUNK);
+            ret = zng_deflate(&strm, left ? Z_NO_FLUSH : Z_FINISH);
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+                fprintf(stderr, "deflate() failed with code %d\n", ret);
+                exit(EXIT_FAILURE);
+            }
+        } while (strm.avail_out == 0);
+    } while (left);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() did not finish at level %d\n", level);
+        exit(EXIT_FAILURE);
+    }
+    out_len = (uint32_t)strm.total_out;
+    zng_deflateEnd(&strm);
+    return out_len;
+}
+
+int main() {
+    /* One level of each match finder: quick, fast, medium, slow and slow with the rolling hash */
+    static const int levels[] = { 1, 2, 3, 6, 8, 9 };
+    static const int hash_lens[] = { 4, 5, 6, 8 };
+    static const int invalid_lens[] = { 0, 3, 7, 9 };
+    uint32_t seed = 1, i, l;
+    zng_stream strm;
+    size_t len;
+
+    /* Alternate between text and binary records of a counter and a few small fields */
+    test_fill_mixed(next_in, HASH_TEST_SIZE, HASH_TEST_SEGMENT, "tb", &seed);
+
+    for (l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        for (i = 0; i < sizeof(hash_lens) / sizeof(hash_lens[0]); i++) {
+            int hash_len = hash_lens[i];
+            int switch_len = hash_lens[(i + 1) % (sizeof(hash_lens) / sizeof(hash_lens[0]))];
+            len = compress_hash_len(levels[l], hash_len, hash_len);
+            test_inflate_check(next_out, len, -15, next_in, HASH_TEST_SIZE, "at level %d with hash length %d",
+                               levels[l], hash_len);
+            len = compress_hash_len(levels[l], hash_len, switch_len);
+            test_inflate_check(next_out, len, -15, next_in, HASH_TEST_SIZE,
+                               "at level %d with hash length %d switched to %d", levels[l], hash_len, switch_len);
+        }
+    }
+
+    memset(&strm, 0, sizeof(strm));
+    if (zng_deflateInit(&strm, Z_DEFAULT_COMPRESSION) != Z_OK) {
+        fprintf(stderr, "deflateInit() failed\n");
+        return EXIT_FAILURE;
+    }
+    for (i = 0; i < sizeof(invalid_lens) / sizeof(invalid_lens[0]); i++) {
+        if (set_hash_len(&strm, invalid_lens[i]) != Z_STREAM_ERROR || get_hash_len(&strm) != 4) {
+            fprintf(stderr, "hash length %d was not refused\n", invalid_lens[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    zng_deflateEnd(&strm);
+    return EXIT_SUCCESS;
+}
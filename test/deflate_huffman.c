@@ -0,0 +1,108 @@
+/* Test that Z_HUFFMAN_ONLY, which encodes its literals straight from the
+ * window, round trips with blocks cut at the window size, with any flush, and
+ * when deflateParams() switches between it and the other strategies.
+ */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "test_shared.h"
+
+#define HUFF_SIZE    (256 * 1024)
+#define HUFF_SEGMENT 16384
+#define HUFF_CHUNK   10000
+
+static unsigned char next_in[HUFF_SIZE];
+static unsigned char next_out[HUFF_SIZE * 2];
+
+/* Compress next_in in pieces, switching to the next of the strategies before each */
+static size_t compress_switching(int level) {
+    static const int strategies[] = { Z_HUFFMAN_ONLY, Z_DEFAULT_STRATEGY, Z_HUFFMAN_ONLY, Z_RLE,
+                                      Z_HUFFMAN_ONLY, Z_FILTERED, Z_FIXED };
+    PREFIX3(stream) strm;
+    uint32_t pos, i = 0;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, -15, 8, Z_HUFFMAN_ONLY);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    strm.next_out = next_out;
+    strm.avail_out = sizeof(next_out);
+    for (pos = 0; pos < HUFF_SIZE; pos += HUFF_CHUNK) {
+        strm.avail_in = 0;
+        if (PREFIX(deflateParams)(&strm, level, strategies[i++ % (sizeof(strategies) / sizeof(strategies[0]))]) != Z_OK) {
+            fprintf(stderr, "deflateParams() failed at level %d\n", level);
+            exit(EXIT_FAILURE);
+        }
+        strm.next_in = next_in + pos;
+        strm.avail_in = MIN(HUFF_CHUNK, HUFF_SIZE - pos);
+        ret = PREFIX(deflate)(&strm, pos + HUFF_CHUNK < HUFF_SIZE ? Z_NO_FLUSH : Z_FINISH);
+        if (ret != Z_OK && ret != Z_STREAM_END) {
+            fprintf(stderr, "deflate() failed with code %d\n", ret);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() did not finish after switching strategies\n");
+        exit(EXIT_FAILURE);
+    }
+    PREFIX(deflateEnd)(&strm);
+    return (size_t)(strm.next_out - next_out);
+}
+
+int main() {
+    static const int window_bits[] = { 9, 12, -15, 31 };
+    static const int flushes[] = { Z_NO_FLUSH, Z_SYNC_FLUSH, Z_BLOCK };
+    static const uint32_t chunks[] = { 1000, 65536 };
+    uint32_t seed = 1, w, f, c;
+    size_t len;
+    int mem_level;
+
+    test_fill_mixed(next_in, HUFF_SIZE, HUFF_SEGMENT, "tbrx", &seed);
+
+    /* Small windows cut the blocks short, so that they are still in the window when sent */
+    for (w = 0; w < sizeof(window_bits) / sizeof(window_bits[0]); w++) {
+        for (mem_level = 1; mem_level <= 9; mem_level += 8) {
+            for (f = 0; f < sizeof(flushes) / sizeof(flushes[0]); f++) {
+                for (c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+                    len = test_deflate(next_in, HUFF_SIZE, next_out, sizeof(next_out), 6, window_bits[w],
+                                       mem_level, Z_HUFFMAN_ONLY, chunks[c], flushes[f]);
+                    test_inflate_check(next_out, len, window_bits[w], next_in, HUFF_SIZE,
+                                       "with memLevel %d, flush %d and pieces of %u bytes", mem_level,
+                                       flushes[f], chunks[c]);
+                }
+            }
+        }
+    }
+
+    for (len = 1; len <= 9; len += 4) {
+        size_t switched = compress_switching((int)len);
+        test_inflate_check(next_out, switched, -15, next_in, HUFF_SIZE, "after switching strategies");
+    }
+
+    /* Text is coded in fewer than 8 bits per byte, random bytes are not expanded much */
+    seed = 1;
+    test_fill_text(next_in, HUFF_SIZE, &seed);
+    len = test_deflate(next_in, HUFF_SIZE, next_out, sizeof(next_out), 6, -15, 8, Z_HUFFMAN_ONLY, HUFF_SIZE,
+                       Z_NO_FLUSH);
+    if (len > HUFF_SIZE * 3 / 4) {
+        fprintf(stderr, "text compressed to %zu bytes with Z_HUFFMAN_ONLY\n", len);
+        return EXIT_FAILURE;
+    }
+    test_fill_random(next_in, HUFF_SIZE, &seed);
+    len = test_deflate(next_in, HUFF_SIZE, next_out, sizeof(next_out), 6, -15, 8, Z_HUFFMAN_ONLY, HUFF_SIZE,
+                       Z_NO_FLUSH);
+    test_inflate_check(next_out, len, -15, next_in, HUFF_SIZE, "random bytes");
+    if (len > HUFF_SIZE + HUFF_SIZE / 100) {
+        fprintf(stderr, "random bytes compressed to %zu bytes with Z_HUFFMAN_ONLY\n", len);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,83 @@
+/* Test that deflate_slow, whose lazy evaluation walks the hash chains only as
+ * deep as the previous match was found plus a margin, keeps compressing the
+ * files of test/data as well as with the bound that was measured. The sizes
+ * grow by a few tenths of a percent when the bound is made much tighter.
+ */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "test_shared.h"
+
+/* Largest compressed sizes at levels 7 to 9, 0.05% above those measured */
+static const struct {
+    const char *name;
+    size_t max_len[3];
+} expected[] = {
+    { "lcet10.txt",     { 142360, 142330, 142740 } },
+    { "paper-100k.pdf", { 82100, 82085, 81205 } }
+};
+
+static unsigned char *read_file(const char *name, size_t *size) {
+    unsigned char *buf;
+    FILE *f = fopen(name, "rb");
+    long len;
+
+    if (f == NULL || fseek(f, 0, SEEK_END) != 0 || (len = ftell(f)) < 0) {
+        fprintf(stderr, "cannot read %s\n", name);
+        exit(EXIT_FAILURE);
+    }
+    rewind(f);
+    buf = (unsigned char *)malloc((size_t)len + 1);
+    if (buf == NULL || fread(buf, 1, (size_t)len, f) != (size_t)len) {
+        fprintf(stderr, "cannot read %s\n", name);
+        exit(EXIT_FAILURE);
+    }
+    fclose(f);
+    *size = (size_t)len;
+    return buf;
+}
+
+int main(int argc, char *argv[]) {
+    unsigned char *in, *out;
+    size_t in_len, out_size, len, name_len, suffix_len, i;
+    int arg, level;
+
+    for (arg = 1; arg < argc; arg++) {
+        name_len = strlen(argv[arg]);
+        for (i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+            suffix_len = strlen(expected[i].name);
+            if (name_len >= suffix_len && strcmp(argv[arg] + name_len - suffix_len, expected[i].name) == 0)
+                break;
+        }
+        if (i == sizeof(expected) / sizeof(expected[0])) {
+            fprintf(stderr, "no expected sizes for %s\n", argv[arg]);
+            return EXIT_FAILURE;
+        }
+
+        in = read_file(argv[arg], &in_len);
+        out_size = in_len + in_len / 100 + 1024;
+        out = (unsigned char *)malloc(out_size);
+        if (out == NULL) {
+            fprintf(stderr, "out of memory\n");
+            return EXIT_FAILURE;
+        }
+        for (level = 7; level <= 9; level++) {
+            len = test_deflate(in, in_len, out, out_size, level, 15, 8, Z_DEFAULT_STRATEGY, (uint32_t)in_len,
+                               Z_NO_FLUSH);
+            test_inflate_check(out, len, 15, in, in_len, "%s at level %d", expected[i].name, level);
+            if (len > expected[i].max_len[level - 7]) {
+                fprintf(stderr, "level %d compressed %s to %zu bytes, more than %zu\n", level, expected[i].name,
+                        len, expected[i].max_len[level - 7]);
+                return EXIT_FAILURE;
+            }
+        }
+        free(out);
+        free(in);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+/* Test that Z_RLE captures short periodic patterns, not only byte runs. */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "test_shared.h"
+
+#define PERIODIC_SIZE 65536
+
+int main() {
+    static unsigned char next_in[PERIODIC_SIZE];
+    static unsigned char next_out[PERIODIC_SIZE * 2];
+    static unsigned char uncompr[PERIODIC_SIZE];
+    PREFIX3(stream) strm;
+    uint32_t compressed_size, pos = 0, seed = 1;
+    unsigned period, i;
+    int ret;
+
+    /* Stretches of repeated 8, 16, 32 and 64-bit values */
+    while (pos < PERIODIC_SIZE) {
+        unsigned char value[8];
+        period = 1u << (pos / 4096 % 4);
+        for (i = 0; i < period; i++)
+            value[i] = (unsigned char)test_rand(&seed);
+        for (i = 0; i < 512 && pos < PERIODIC_SIZE; i++, pos++)
+            next_in[pos] = value[i % period];
+    }
+
+    memset(&strm, 0, sizeof(strm));
+    ret = PREFIX(deflateInit2)(&strm, 1, Z_DEFLATED, -15, 8, Z_RLE);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        return EXIT_FAILURE;
+    }
+    strm.next_in = next_in;
+    strm.avail_in = sizeof(next_in);
+    strm.next_out = next_out;
+    strm.avail_out = sizeof(next_out);
+    ret = PREFIX(deflate)(&strm, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() failed with code %d\n", ret);
+        return EXIT_FAILURE;
+    }
+    compressed_size = (uint32_t)strm.total_out;
+    ret = PREFIX(deflateEnd)(&strm);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateEnd() failed with code %d\n", ret);
+        return EXIT_FAILURE;
+    }
+
+    /* Each 512 byte stretch is a few literals and two or three matches */
+    if (compressed_size > PERIODIC_SIZE / 16) {
+        fprintf(stderr, "periodic input compressed to %u bytes\n", compressed_size);
+        return EXIT_FAILURE;
+    }
+
+    memset(&strm, 0, sizeof(strm));
+    ret = PREFIX(inflateInit2)(&strm, -15);
+    if (ret != Z_OK) {
+        fprintf(stderr, "inflateInit2() failed with code %d\n", ret);
+        return EXIT_FAILURE;
+    }
+    strm.next_in = next_out;
+    strm.avail_in = compressed_size;
+    strm.next_out = uncompr;
+    strm.avail_out = sizeof(uncompr);
+    ret = PREFIX(inflate)(&strm, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "inflate() failed with code %d\n", ret);
+        return EXIT_FAILURE;
+    }
+    ret = PREFIX(inflateEnd)(&strm);
+    if (ret != Z_OK) {
+        fprintf(stderr, "inflateEnd() failed with code %d\n", ret);
+        return EXIT_FAILURE;
+    }
+
+    if (memcmp(uncompr, next_in, sizeof(next_in)) != 0) {
+        fprintf(stderr, "inflated data does not match\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
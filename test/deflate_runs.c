@@ -0,0 +1,91 @@
+/* Test that deflate_fast and deflate_medium, which send runs of one byte as
+ * maximum length matches at distance one, round trip runs at the start and the
+ * end of the input and across the pieces it is passed in, and still find
+ * matches into the bytes around a run.
+ */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "test_shared.h"
+
+#define RUNS_SIZE    (256 * 1024)
+
+static unsigned char next_in[RUNS_SIZE];
+static unsigned char next_out[RUNS_SIZE * 2];
+
+/* Runs of a byte value up to a few thousand bytes long between short pieces of
+ * text, starting with a run */
+static void fill_long_runs(unsigned char *buf, size_t len, uint32_t *seed) {
+    size_t pos = 0, n;
+
+    while (pos < len) {
+        n = MIN(len - pos, 1 + test_rand(seed) % 4000);
+        memset(buf + pos, test_rand(seed) % 4 == 0 ? 0 : (int)(test_rand(seed) & 0xff), n);
+        pos += n;
+        n = MIN(len - pos, test_rand(seed) % 300);
+        test_fill_text(buf + pos, n, seed);
+        pos += n;
+    }
+}
+
+int main() {
+    static const int window_bits[] = { 9, -15, 31 };
+    static const int flushes[] = { Z_NO_FLUSH, Z_SYNC_FLUSH };
+    static const uint32_t chunks[] = { 259, 4093, RUNS_SIZE };
+    uint32_t seed = 1, w, f, c;
+    size_t len, other_len;
+    int level;
+
+    fill_long_runs(next_in, RUNS_SIZE - 1000, &seed);
+    /* End with a run that is cut short by the end of the input */
+    memset(next_in + RUNS_SIZE - 1000, 'a', 1000);
+
+    for (level = 1; level <= 9; level++) {
+        for (w = 0; w < sizeof(window_bits) / sizeof(window_bits[0]); w++) {
+            for (f = 0; f < sizeof(flushes) / sizeof(flushes[0]); f++) {
+                for (c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+                    len = test_deflate(next_in, RUNS_SIZE, next_out, sizeof(next_out), level, window_bits[w], 8,
+                                       Z_DEFAULT_STRATEGY, chunks[c], flushes[f]);
+                    test_inflate_check(next_out, len, window_bits[w], next_in, RUNS_SIZE,
+                                       "at level %d with flush %d and pieces of %u bytes", level, flushes[f],
+                                       chunks[c]);
+                }
+            }
+        }
+    }
+
+    for (level = 2; level <= 6; level++) {
+        /* Zeros compress close to the limit of about 1030 to 1 */
+        memset(next_in, 0, RUNS_SIZE);
+        len = test_deflate(next_in, RUNS_SIZE, next_out, sizeof(next_out), level, -15, 8, Z_DEFAULT_STRATEGY,
+                           RUNS_SIZE, Z_NO_FLUSH);
+        test_inflate_check(next_out, len, -15, next_in, RUNS_SIZE, "zeros at level %d", level);
+        if (len > RUNS_SIZE / 900) {
+            fprintf(stderr, "level %d compressed %d zeros to %zu bytes\n", level, RUNS_SIZE, len);
+            return EXIT_FAILURE;
+        }
+
+        /* Text repeated after a run is matched into the text before it */
+        seed = 1;
+        test_fill_text(next_in, 2000, &seed);
+        memset(next_in + 2000, ' ', 10000);
+        test_fill_text(next_in + 12000, 2000, &seed);
+        other_len = test_deflate(next_in, 14000, next_out, sizeof(next_out), level, -15, 8, Z_DEFAULT_STRATEGY,
+                                 14000, Z_NO_FLUSH);
+        memcpy(next_in + 12000, next_in, 2000);
+        len = test_deflate(next_in, 14000, next_out, sizeof(next_out), level, -15, 8, Z_DEFAULT_STRATEGY,
+                           14000, Z_NO_FLUSH);
+        test_inflate_check(next_out, len, -15, next_in, 14000, "repeated text at level %d", level);
+        if (len > other_len * 3 / 4) {
+            fprintf(stderr, "level %d compressed text, a run and the text again to %zu bytes, %zu with new text\n",
+                    level, len, other_len);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,249 @@
+/* Test that the parse handed to deflateSequences() round trips with every wrapper
+ * and block type, when the input, the output and the sequences come in pieces
+ * that do not line up, and that invalid sequences are refused.
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "test_shared.h"
+
+#define SEQ_TEST_SIZE    (256 * 1024)
+#define SEQ_TEST_SEGMENT 16384
+#define SEQ_TEST_CHUNK   4093
+#define SEQ_HASH_BITS    14
+
+static unsigned char next_in[SEQ_TEST_SIZE];
+static unsigned char next_out[SEQ_TEST_SIZE * 2];
+static zng_deflate_sequence seqs[SEQ_TEST_SIZE];
+static zng_deflate_sequence sent[SEQ_TEST_SIZE];
+
+/* Greedy parse of next_in with matches at most max_dist back, as an application
+ * with its own match finder would hand it over. The input after the last match
+ * is left out, deflate sends it as literals. */
+static size_t parse(uint32_t max_dist) {
+    static uint32_t head[1 << SEQ_HASH_BITS];
+    uint32_t pos = 0, lits = 0, h, cand, len;
+    size_t count = 0;
+
+    memset(head, 0xff, sizeof(head));
+    while (pos + 3 <= SEQ_TEST_SIZE) {
+        h = ((next_in[pos] << 16 | next_in[pos + 1] << 8 | next_in[pos + 2]) * 2654435761u) >> (32 - SEQ_HASH_BITS);
+        cand = head[h];
+        head[h] = pos;
+        len = 0;
+        if (cand != 0xffffffff && pos - cand <= max_dist) {
+            while (len < 258 && pos + len < SEQ_TEST_SIZE && next_in[cand + len] == next_in[pos + len])
+                len++;
+        }
+        if (len < 3) {
+            lits++;
+            pos++;
+            continue;
+        }
+        seqs[count].lit_len = lits;
+        seqs[count].match_len = len;
+        seqs[count].dist = pos - cand;
+        count++;
+        lits = 0;
+        pos += len;
+    }
+    return count;
+}
+
+static void init_stream(zng_stream *strm, int level, int window_bits, int strategy) {
+    int ret;
+
+    memset(strm, 0, sizeof(*strm));
+    ret = zng_deflateInit2(strm, level, Z_DEFLATED, window_bits, 8, strategy);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* Send count sequences of next_in with the input in chunks of in_chunk bytes,
+ * the output in chunks of SEQ_TEST_CHUNK bytes and the sequences in batches of
+ * batch, but all of those left when finishing */
+static uint32_t compress_seqs(int level, int window_bits, int strategy, size_t count, uint32_t in_chunk,
+                              size_t batch) {
+    zng_stream strm;
+    uint32_t left = SEQ_TEST_SIZE, out_len;
+    size_t done = 0, n;
+    int flush, ret;
+
+    memcpy(sent, seqs, count * sizeof(seqs[0]));
+    init_stream(&strm, level, window_bits, strategy);
+    strm.next_in = next_in;
+    strm.next_out = next_out;
+    do {
+        n = MIN(left, in_chunk);
+        strm.avail_in += (uint32_t)n;
+        left -= (uint32_t)n;
+        flush = left ? Z_NO_FLUSH : Z_FINISH;
+        do {
+            out_len = (uint32_t)(sizeof(next_out) - strm.total_out);
+            strm.avail_out = MIN(out_len, SEQ_TEST_CHUNK);
+            n = flush == Z_NO_FLUSH ? MIN(count - done, batch) : count - done;
+            ret = zng_deflateSequences(&strm, sent + done, &n, flush);
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+                fprintf(stderr, "deflateSequences() failed with code %d: %s\n", ret, strm.msg ? strm.msg : "");
+                exit(EXIT_FAILURE);
+            }
+            done += n;
+        } while (strm.avail_out == 0 || (done < count && strm.avail_in != 0));
+    } while (left);
+    if (ret != Z_STREAM_END || done != count) {
+        fprintf(stderr, "deflateSequences() did not finish at level %d\n", level);
+        exit(EXIT_FAILURE);
+    }
+    out_len = (uint32_t)strm.total_out;
+    zng_deflateEnd(&strm);
+    return out_len;
+}
+
+/* Send the sequences that end in the first half of next_in with a sync flush,
+ * then the second half with deflate() */
+static uint32_t compress_mixed(int level, int window_bits, int strategy, size_t count) {
+    zng_stream strm;
+    uint32_t half = 0, out_len;
+    size_t n = 0;
+    int ret;
+
+    while (n < count && half + seqs[n].lit_len + seqs[n].match_len <= SEQ_TEST_SIZE / 2) {
+        half += seqs[n].lit_len + seqs[n].match_len;
+        n++;
+    }
+    memcpy(sent, seqs, n * sizeof(seqs[0]));
+    init_stream(&strm, level, window_bits, strategy);
+    strm.next_in = next_in;
+    strm.avail_in = half;
+    strm.next_out = next_out;
+    strm.avail_out = sizeof(next_out);
+    ret = zng_deflateSequences(&strm, sent, &n, Z_SYNC_FLUSH);
+    if (ret != Z_OK || strm.avail_in != 0) {
+        fprintf(stderr, "deflateSequences() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    strm.avail_in = SEQ_TEST_SIZE - half;
+    ret = zng_deflate(&strm, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() after deflateSequences() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    out_len = (uint32_t)strm.total_out;
+    zng_deflateEnd(&strm);
+    return out_len;
+}
+
+/* Check that the sequence is refused with Z_DATA_ERROR after the valid ones
+ * before it, which leave 16 bytes of history */
+static void check_refused(zng_deflate_sequence bad, uint32_t avail_in, int flush, const char *what) {
+    zng_deflate_sequence list[2];
+    zng_stream strm;
+    size_t n = 2;
+    int ret;
+
+    list[0].lit_len = 16;
+    list[0].match_len = 0;
+    list[0].dist = 0;
+    list[1] = bad;
+    init_stream(&strm, 6, 15, Z_DEFAULT_STRATEGY);
+    strm.next_in = next_in;
+    strm.avail_in = avail_in;
+    strm.next_out = next_out;
+    strm.avail_out = sizeof(next_out);
+    ret = zng_deflateSequences(&strm, list, &n, flush);
+    if (ret != Z_DATA_ERROR || n != 1 || strm.msg == NULL) {
+        fprintf(stderr, "%s was not refused\n", what);
+        exit(EXIT_FAILURE);
+    }
+    zng_deflateEnd(&strm);
+}
+
+int main() {
+    static const int strategies[] = { Z_DEFAULT_STRATEGY, Z_FIXED, Z_HUFFMAN_ONLY };
+    static const int wraps[] = { -15, 15, 31 };
+    zng_deflate_sequence bad;
+    zng_stream strm;
+    uint32_t seed = 1, stored_len, len, i, w;
+    size_t count, n;
+    int ret;
+
+    /* Alternate between text, binary records and random bytes */
+    test_fill_mixed(next_in, SEQ_TEST_SIZE, SEQ_TEST_SEGMENT, "tbx", &seed);
+
+    count = parse(32768 - 262);
+    stored_len = compress_seqs(0, 15, Z_DEFAULT_STRATEGY, count, SEQ_TEST_SIZE, count);
+    test_inflate_check(next_out, stored_len, 15, next_in, SEQ_TEST_SIZE, "stored sequences");
+    if (stored_len < SEQ_TEST_SIZE) {
+        fprintf(stderr, "level 0 compressed the sequences to %u bytes\n", stored_len);
+        return EXIT_FAILURE;
+    }
+    for (w = 0; w < sizeof(wraps) / sizeof(wraps[0]); w++) {
+        for (i = 0; i < sizeof(strategies) / sizeof(strategies[0]); i++) {
+            len = compress_seqs(6, wraps[w], strategies[i], count, SEQ_TEST_CHUNK, 1000);
+            test_inflate_check(next_out, len, wraps[w], next_in, SEQ_TEST_SIZE, "sequences");
+            if (len >= stored_len * 3 / 4) {
+                fprintf(stderr, "sequences compressed to %u bytes with strategy %d\n", len, strategies[i]);
+                return EXIT_FAILURE;
+            }
+            len = compress_seqs(6, wraps[w], strategies[i], count, 1000, 7);
+            test_inflate_check(next_out, len, wraps[w], next_in, SEQ_TEST_SIZE, "sequences in small batches");
+            len = compress_mixed(1, wraps[w], strategies[i], count);
+            test_inflate_check(next_out, len, wraps[w], next_in, SEQ_TEST_SIZE, "sequences finished by deflate()");
+        }
+    }
+    count = parse(1024 - 262);
+    len = compress_seqs(9, 10, Z_DEFAULT_STRATEGY, count, SEQ_TEST_CHUNK, 100);
+    test_inflate_check(next_out, len, 10, next_in, SEQ_TEST_SIZE, "sequences in a small window");
+
+    bad.lit_len = 0;
+    bad.match_len = 4;
+    bad.dist = 17;
+    check_refused(bad, 64, Z_NO_FLUSH, "distance before the start of the stream");
+    bad.dist = 0;
+    check_refused(bad, 64, Z_NO_FLUSH, "distance 0");
+    bad.dist = 16;
+    bad.match_len = 2;
+    check_refused(bad, 64, Z_NO_FLUSH, "length 2");
+    bad.match_len = 259;
+    check_refused(bad, 64, Z_NO_FLUSH, "length 259");
+    bad.match_len = 4;
+    check_refused(bad, 64, Z_NO_FLUSH, "match that does not match");
+    bad.lit_len = 40;
+    check_refused(bad, 32, Z_FINISH, "sequence past the end of the input");
+
+    /* deflate() cannot go on with a block started by deflateSequences() */
+    init_stream(&strm, 6, 15, Z_DEFAULT_STRATEGY);
+    strm.next_in = next_in;
+    strm.avail_in = 1000;
+    strm.next_out = next_out;
+    strm.avail_out = sizeof(next_out);
+    n = 0;
+    if (zng_deflateSequences(&strm, NULL, &n, Z_NO_FLUSH) != Z_OK || zng_deflate(&strm, Z_FINISH) != Z_STREAM_ERROR) {
+        fprintf(stderr, "deflate() went on with the block of deflateSequences()\n");
+        return EXIT_FAILURE;
+    }
+    n = 0;
+    ret = zng_deflateSequences(&strm, NULL, &n, Z_FINISH);
+    if (ret != Z_STREAM_END || strm.total_in != 1000) {
+        fprintf(stderr, "deflateSequences() did not finish with literals, code %d\n", ret);
+        return EXIT_FAILURE;
+    }
+    zng_deflateEnd(&strm);
+
+    /* nor deflateSequences() with the input deflate() is in the middle of */
+    init_stream(&strm, 6, 15, Z_DEFAULT_STRATEGY);
+    strm.next_in = next_in;
+    strm.avail_in = 1000;
+    strm.next_out = next_out;
+    strm.avail_out = sizeof(next_out);
+    n = 0;
+    if (zng_deflate(&strm, Z_NO_FLUSH) != Z_OK || zng_deflateSequences(&strm, NULL, &n, Z_FINISH) != Z_STREAM_ERROR) {
+        fprintf(stderr, "deflateSequences() went on with the block of deflate()\n");
+        return EXIT_FAILURE;
+    }
+    zng_deflateEnd(&strm);
+    return EXIT_SUCCESS;
+}
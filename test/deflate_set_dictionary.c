@@ -0,0 +1,87 @@
+/* Test that deflateSetDictionary() hashes the dictionary the way the level
+ * searches it, so that a message made of pieces of a random dictionary is
+ * found in it at every level, including the rolling hash of level 9.
+ */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "test_shared.h"
+
+#define DICT_SIZE    8192
+#define MESSAGE_SIZE 16384
+#define PIECE_SIZE   1024
+
+static unsigned char dictionary[DICT_SIZE];
+static unsigned char message[MESSAGE_SIZE];
+static unsigned char compr[MESSAGE_SIZE * 2];
+static unsigned char uncompr[MESSAGE_SIZE];
+
+static size_t compress_dict(int level) {
+    PREFIX3(stream) strm;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK || PREFIX(deflateSetDictionary)(&strm, dictionary, DICT_SIZE) != Z_OK) {
+        fprintf(stderr, "deflateSetDictionary() failed at level %d\n", level);
+        exit(EXIT_FAILURE);
+    }
+    strm.next_in = message;
+    strm.avail_in = MESSAGE_SIZE;
+    strm.next_out = compr;
+    strm.avail_out = sizeof(compr);
+    if (PREFIX(deflate)(&strm, Z_FINISH) != Z_STREAM_END) {
+        fprintf(stderr, "deflate() did not finish at level %d\n", level);
+        exit(EXIT_FAILURE);
+    }
+    PREFIX(deflateEnd)(&strm);
+    return (size_t)strm.total_out;
+}
+
+static void inflate_dict(size_t compr_len, int level) {
+    PREFIX3(stream) strm;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = PREFIX(inflateInit2)(&strm, -15);
+    if (ret != Z_OK || PREFIX(inflateSetDictionary)(&strm, dictionary, DICT_SIZE) != Z_OK) {
+        fprintf(stderr, "inflateSetDictionary() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    strm.next_in = compr;
+    strm.avail_in = (uint32_t)compr_len;
+    strm.next_out = uncompr;
+    strm.avail_out = sizeof(uncompr);
+    ret = PREFIX(inflate)(&strm, Z_FINISH);
+    if (ret != Z_STREAM_END || strm.total_out != MESSAGE_SIZE || memcmp(uncompr, message, MESSAGE_SIZE) != 0) {
+        fprintf(stderr, "inflated data does not match at level %d\n", level);
+        exit(EXIT_FAILURE);
+    }
+    PREFIX(inflateEnd)(&strm);
+}
+
+int main() {
+    uint32_t seed = 1, pos;
+    size_t len;
+    int level;
+
+    test_fill_random(dictionary, DICT_SIZE, &seed);
+    for (pos = 0; pos < MESSAGE_SIZE; pos += PIECE_SIZE)
+        memcpy(message + pos, dictionary + test_rand(&seed) % (DICT_SIZE - PIECE_SIZE), PIECE_SIZE);
+
+    for (level = 1; level <= 9; level++) {
+        len = compress_dict(level);
+        inflate_dict(len, level);
+        /* A few matches of at most 258 bytes per piece, a few bytes each */
+        if (len > MESSAGE_SIZE / 64) {
+            fprintf(stderr, "level %d compressed the message to %zu bytes with the dictionary\n", level, len);
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
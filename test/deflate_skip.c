@@ -0,0 +1,96 @@
+/* Test that deflate_medium and deflate_slow, which skip ahead and send stored
+ * blocks over incompressible input, round trip, stay within deflateBound(), pick
+ * up matches again inside and after random data, and do not store what would
+ * compress.
+ */
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#include "test_shared.h"
+
+#define SKIP_SIZE    (256 * 1024)
+
+static unsigned char next_in[SKIP_SIZE];
+static unsigned char next_out[SKIP_SIZE * 2];
+
+static size_t compress_len(size_t len, int level) {
+    size_t out_len = test_deflate(next_in, len, next_out, sizeof(next_out), level, -15, 8, Z_DEFAULT_STRATEGY,
+                                  (uint32_t)len, Z_NO_FLUSH);
+    test_inflate_check(next_out, out_len, -15, next_in, len, "at level %d", level);
+    return out_len;
+}
+
+static size_t deflate_bound(size_t len, int level) {
+    PREFIX3(stream) strm;
+    size_t bound;
+
+    memset(&strm, 0, sizeof(strm));
+    if (PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed at level %d\n", level);
+        exit(EXIT_FAILURE);
+    }
+    bound = (size_t)PREFIX(deflateBound)(&strm, (unsigned long)len);
+    PREFIX(deflateEnd)(&strm);
+    return bound;
+}
+
+int main() {
+    static const int window_bits[] = { 9, -15, 31 };
+    static const int flushes[] = { Z_NO_FLUSH, Z_SYNC_FLUSH };
+    uint32_t seed = 1, w, f;
+    size_t len, random_len, text_len;
+    int level, mem_level;
+
+    for (level = 3; level <= 9; level++) {
+        /* Text after random data is compressed as well as without it */
+        seed = 1;
+        test_fill_text(next_in, SKIP_SIZE / 2, &seed);
+        text_len = compress_len(SKIP_SIZE / 2, level);
+        test_fill_random(next_in, SKIP_SIZE / 2, &seed);
+        random_len = compress_len(SKIP_SIZE / 2, level);
+        seed = 1;
+        test_fill_text(next_in + SKIP_SIZE / 2, SKIP_SIZE / 2, &seed);
+        len = compress_len(SKIP_SIZE, level);
+        if (len > random_len + text_len + text_len / 8) {
+            fprintf(stderr, "level %d compressed text after random data to %zu bytes, %zu + %zu apart\n",
+                    level, len, random_len, text_len);
+            return EXIT_FAILURE;
+        }
+        if (random_len > deflate_bound(SKIP_SIZE / 2, level)) {
+            fprintf(stderr, "level %d expanded random data to %zu bytes, past deflateBound()\n", level, random_len);
+            return EXIT_FAILURE;
+        }
+
+        /* A repeat well into random data is still found */
+        test_fill_random(next_in, 40000, &seed);
+        memcpy(next_in + 40000, next_in + 20000, 16000);
+        test_fill_random(next_in + 56000, 16000, &seed);
+        len = compress_len(72000, level);
+        if (len > 58000) {
+            fprintf(stderr, "level %d missed the repeat in random data, %zu bytes\n", level, len);
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* Stored blocks from the skip, with little room in pending_buf and the output */
+    seed = 1;
+    test_fill_mixed(next_in, SKIP_SIZE, 40000, "xtxb", &seed);
+    for (level = 4; level <= 8; level += 2) {
+        for (w = 0; w < sizeof(window_bits) / sizeof(window_bits[0]); w++) {
+            for (mem_level = 1; mem_level <= 8; mem_level += 7) {
+                for (f = 0; f < sizeof(flushes) / sizeof(flushes[0]); f++) {
+                    len = test_deflate(next_in, SKIP_SIZE, next_out, sizeof(next_out), level, window_bits[w],
+                                       mem_level, Z_DEFAULT_STRATEGY, 3000, flushes[f]);
+                    test_inflate_check(next_out, len, window_bits[w], next_in, SKIP_SIZE,
+                                       "at level %d with memLevel %d and flush %d", level, mem_level, flushes[f]);
+                }
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,283 @@
+/* Test that deflate and inflate streams that hibernate between messages give
+ * the same output as streams that never do, and that hibernating frees memory.
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "test_shared.h"
+
+#define MESSAGES     64
+#define MAX_MESSAGE  4096
+
+typedef struct {
+    int level;
+    int window_bits;
+    int mem_level;
+    int strategy;
+    int switch_level;   /* level from message MESSAGES / 2 on */
+    int hash_freed;     /* whether hibernating must free the hash chains, which level 9 inserts in order */
+} config;
+
+static unsigned char message[MAX_MESSAGE];
+static unsigned char expected[MAX_MESSAGE * 2];
+static unsigned char compr[MAX_MESSAGE * 2];
+static unsigned char uncompr[MAX_MESSAGE];
+static size_t allocated;
+
+/* Allocator counting the bytes in use */
+static void *count_alloc(void *opaque, unsigned items, unsigned size) {
+    size_t *block = (size_t *)malloc(sizeof(size_t) * 2 + (size_t)items * size);
+    (void)opaque;
+    if (block == NULL)
+        return NULL;
+    block[0] = (size_t)items * size;
+    allocated += block[0];
+    return block + 2;
+}
+
+static void count_free(void *opaque, void *address) {
+    size_t *block = (size_t *)address - 2;
+    (void)opaque;
+    allocated -= block[0];
+    free(block);
+}
+
+/* Messages of text with numbers, or of binary records */
+static uint32_t make_message(uint32_t *seed) {
+    static const char *words[] = { "{\"type\": ", "\"update\", ", "\"id\": ", "\"name\": ", "\"value\": ",
+                                   "\"status\", ", "}, ", "[", "]", "\"ok\"", "null, ", "true, " };
+    uint32_t len = 32 + test_rand(seed) % (MAX_MESSAGE - 32), pos = 0;
+
+    if (test_rand(seed) % 4 == 0) {
+        test_fill_records(message, len, seed);
+        return len;
+    }
+    while (pos < len) {
+        const char *word = words[test_rand(seed) % (sizeof(words) / sizeof(words[0]))];
+        if (test_rand(seed) % 3 == 0 && pos + 6 < len)
+            pos += (uint32_t)snprintf((char *)message + pos, 7, "%u, ", test_rand(seed) % 1000);
+        while (*word && pos < len)
+            message[pos++] = (unsigned char)*word++;
+    }
+    return len;
+}
+
+static void init_streams(zng_stream *strm, zng_stream *inf, const config *c) {
+    memset(strm, 0, sizeof(*strm));
+    strm->zalloc = count_alloc;
+    strm->zfree = count_free;
+    if (zng_deflateInit2(strm, c->level, Z_DEFLATED, c->window_bits, c->mem_level, c->strategy) != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(inf, 0, sizeof(*inf));
+    inf->zalloc = count_alloc;
+    inf->zfree = count_free;
+    if (zng_inflateInit2(inf, c->window_bits) != Z_OK) {
+        fprintf(stderr, "inflateInit2() failed\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* Compress message with Z_SYNC_FLUSH and return the length of the output */
+static size_t compress_message(zng_stream *strm, uint32_t len, unsigned char *out) {
+    strm->next_in = message;
+    strm->avail_in = len;
+    strm->next_out = out;
+    strm->avail_out = MAX_MESSAGE * 2;
+    if (zng_deflate(strm, Z_SYNC_FLUSH) != Z_OK || strm->avail_in != 0 || strm->avail_out == 0) {
+        fprintf(stderr, "deflate() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return (size_t)(strm->next_out - out);
+}
+
+static void inflate_message(zng_stream *inf, size_t compr_len, uint32_t len) {
+    inf->next_in = compr;
+    inf->avail_in = (uint32_t)compr_len;
+    inf->next_out = uncompr;
+    inf->avail_out = MAX_MESSAGE;
+    if (zng_inflate(inf, Z_SYNC_FLUSH) != Z_OK || inf->avail_in != 0 || MAX_MESSAGE - inf->avail_out != len ||
+        memcmp(uncompr, message, len) != 0) {
+        fprintf(stderr, "inflate() failed\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void check_config(const config *c) {
+    zng_stream strm, inf, hib, hib_inf, copy;
+    size_t expected_len, compr_len, before, freed_min = (size_t)-1;
+    uint32_t seed = 7, len, m;
+    int w_bits = c->window_bits < 0 ? -c->window_bits : c->window_bits & 15;
+
+    init_streams(&strm, &inf, c);
+    init_streams(&hib, &hib_inf, c);
+    for (m = 0; m < MESSAGES; m++) {
+        len = make_message(&seed);
+        if (m == MESSAGES / 2 && c->switch_level != c->level) {
+            if (zng_deflateParams(&strm, c->switch_level, c->strategy) != Z_OK ||
+                zng_deflateParams(&hib, c->switch_level, c->strategy) != Z_OK) {
+                fprintf(stderr, "deflateParams() failed\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+        if (m == MESSAGES * 3 / 4) {
+            /* A copy of a hibernating stream goes on like the stream */
+            if (zng_deflateCopy(&copy, &hib) != Z_OK) {
+                fprintf(stderr, "deflateCopy() failed\n");
+                exit(EXIT_FAILURE);
+            }
+            compr_len = compress_message(&copy, len, compr);
+            zng_deflateEnd(&copy);
+            if (zng_deflateHibernate(&hib) != Z_OK) {
+                fprintf(stderr, "deflateHibernate() failed after deflateCopy()\n");
+                exit(EXIT_FAILURE);
+            }
+            if (zng_inflateCopy(&copy, &hib_inf) != Z_OK) {
+                fprintf(stderr, "inflateCopy() failed\n");
+                exit(EXIT_FAILURE);
+            }
+            inflate_message(&copy, compr_len, len);
+            zng_inflateEnd(&copy);
+        }
+        if (m == MESSAGES * 7 / 8) {
+            if (zng_deflateReset(&strm) != Z_OK || zng_deflateReset(&hib) != Z_OK ||
+                zng_inflateReset(&hib_inf) != Z_OK) {
+                fprintf(stderr, "resetting failed\n");
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        expected_len = compress_message(&strm, len, expected);
+        compr_len = compress_message(&hib, len, compr);
+        if (compr_len != expected_len || memcmp(compr, expected, expected_len) != 0) {
+            fprintf(stderr, "hibernating stream differs at message %u at level %d to %d with windowBits %d, "
+                    "memLevel %d and strategy %d\n", m, c->level, c->switch_level, c->window_bits, c->mem_level,
+                    c->strategy);
+            exit(EXIT_FAILURE);
+        }
+        inflate_message(&hib_inf, compr_len, len);
+
+        before = allocated;
+        if (zng_deflateHibernate(&hib) != Z_OK || zng_deflateHibernate(&hib) != Z_OK ||
+            zng_inflateHibernate(&hib_inf) != Z_OK || zng_inflateHibernate(&hib_inf) != Z_OK) {
+            fprintf(stderr, "hibernating failed\n");
+            exit(EXIT_FAILURE);
+        }
+        if (m < MESSAGES / 2)
+            freed_min = MIN(freed_min, before - allocated);
+    }
+    /* pending_buf at least, and prev too when the hash chains go */
+    if (freed_min < ((size_t)1 << (c->mem_level + 8)) +
+                    (c->hash_freed ? (size_t)2 << w_bits : 0)) {
+        fprintf(stderr, "hibernating freed %zu bytes only at level %d with windowBits %d and memLevel %d\n",
+                freed_min, c->level, c->window_bits, c->mem_level);
+        exit(EXIT_FAILURE);
+    }
+
+    zng_deflateEnd(&strm);
+    zng_inflateEnd(&inf);
+    zng_deflateEnd(&hib);
+    zng_inflateEnd(&hib_inf);
+    if (allocated != 0) {
+        fprintf(stderr, "%zu bytes still allocated\n", allocated);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/* Streams hibernate at the end of a block only, and may be forked into */
+static void check_block_end(void) {
+    static const config c = { 6, 15, 8, Z_DEFAULT_STRATEGY, 6, 0 };
+    zng_stream strm, inf, fork, fork_inf;
+    uint32_t seed = 3, len;
+    size_t compr_len, expected_len;
+
+    init_streams(&strm, &inf, &c);
+    len = make_message(&seed);
+    strm.next_in = message;
+    strm.avail_in = len;
+    strm.next_out = compr;
+    strm.avail_out = 1;
+    if (zng_deflate(&strm, Z_SYNC_FLUSH) != Z_OK || zng_deflateHibernate(&strm) != Z_BUF_ERROR) {
+        fprintf(stderr, "deflateHibernate() did not refuse pending output\n");
+        exit(EXIT_FAILURE);
+    }
+    strm.avail_out = MAX_MESSAGE * 2 - 1;
+    if (zng_deflate(&strm, Z_SYNC_FLUSH) != Z_OK || zng_deflateHibernate(&strm) != Z_OK) {
+        fprintf(stderr, "deflateHibernate() failed after the output was taken\n");
+        exit(EXIT_FAILURE);
+    }
+    compr_len = (size_t)(strm.next_out - compr);
+
+    inf.next_in = compr;
+    inf.avail_in = (uint32_t)compr_len / 2;
+    inf.next_out = uncompr;
+    inf.avail_out = MAX_MESSAGE;
+    if (zng_inflate(&inf, Z_SYNC_FLUSH) != Z_OK || zng_inflateHibernate(&inf) != Z_BUF_ERROR) {
+        fprintf(stderr, "inflateHibernate() did not refuse a stream inside a block\n");
+        exit(EXIT_FAILURE);
+    }
+    inf.avail_in = (uint32_t)(compr_len - compr_len / 2);
+    if (zng_inflate(&inf, Z_SYNC_FLUSH) != Z_OK || zng_inflateHibernate(&inf) != Z_OK ||
+        memcmp(uncompr, message, len) != 0) {
+        fprintf(stderr, "inflateHibernate() failed at the end of a block\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Fork into a hibernating stream, and go on with both */
+    init_streams(&fork, &fork_inf, &c);
+    zng_inflateEnd(&fork_inf);
+    if (zng_deflateHibernate(&fork) != Z_OK || zng_deflateFork(&fork, &strm) != Z_OK ||
+        zng_inflateCopy(&fork_inf, &inf) != Z_OK) {
+        fprintf(stderr, "forking a hibernating stream failed\n");
+        exit(EXIT_FAILURE);
+    }
+    len = make_message(&seed);
+    expected_len = compress_message(&strm, len, expected);
+    compr_len = compress_message(&fork, len, compr);
+    if (compr_len != expected_len || memcmp(compr, expected, expected_len) != 0) {
+        fprintf(stderr, "fork of a hibernating stream differs\n");
+        exit(EXIT_FAILURE);
+    }
+    inflate_message(&fork_inf, compr_len, len);
+    inflate_message(&inf, compr_len, len);
+
+    zng_deflateEnd(&fork);
+    zng_inflateEnd(&fork_inf);
+    zng_deflateEnd(&strm);
+    zng_inflateEnd(&inf);
+    if (allocated != 0) {
+        fprintf(stderr, "%zu bytes still allocated\n", allocated);
+        exit(EXIT_FAILURE);
+    }
+}
+
+int main(void) {
+    static const config configs[] = {
+        { 0, 15, 8, Z_DEFAULT_STRATEGY, 6, 0 },
+        { 1, 15, 8, Z_DEFAULT_STRATEGY, 1, 0 },
+        { 2, 15, 8, Z_DEFAULT_STRATEGY, 2, 0 },
+        { 3, 15, 8, Z_DEFAULT_STRATEGY, 3, 0 },
+        { 6, 15, 8, Z_DEFAULT_STRATEGY, 6, 0 },
+        { 7, 15, 8, Z_DEFAULT_STRATEGY, 7, 0 },
+        { 9, 15, 8, Z_DEFAULT_STRATEGY, 9, 1 },
+        { 6, -15, 8, Z_DEFAULT_STRATEGY, 6, 0 },
+        { 9, -10, 9, Z_DEFAULT_STRATEGY, 9, 1 },
+        { 9, 31, 1, Z_DEFAULT_STRATEGY, 9, 1 },
+        { 1, 15, 8, Z_DEFAULT_STRATEGY, 9, 0 },
+        { 9, 15, 8, Z_DEFAULT_STRATEGY, 1, 0 },
+        { 6, 15, 8, Z_DEFAULT_STRATEGY, 0, 0 },
+        { 6, 15, 8, Z_FILTERED, 6, 0 },
+        { 6, 15, 8, Z_HUFFMAN_ONLY, 6, 0 },
+        { 6, 15, 8, Z_RLE, 6, 0 },
+        { 6, 15, 8, Z_FIXED, 6, 0 },
+        { 6, 15, 8, Z_ADAPTIVE, 6, 0 },
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(configs) / sizeof(configs[0]); i++)
+        check_config(&configs[i]);
+    check_block_end();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,177 @@
+/* Test that a dictionary attached with zng_inflateAttachDictionary() inflates
+ * the same as one set with inflateSetDictionary(), whether inflate() finishes
+ * in one call or has to copy the dictionary to the window, and that it is
+ * never written.
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "test_shared.h"
+
+#define DICT_SIZE     40000
+#define MESSAGE_SIZE  3000
+
+static unsigned char dictionary[DICT_SIZE];
+static unsigned char pristine[DICT_SIZE];
+static unsigned char message[MESSAGE_SIZE];
+static unsigned char compr[MESSAGE_SIZE * 2];
+static unsigned char uncompr[MESSAGE_SIZE];
+
+/* Compress message after the dictionary, whose window is the last 1 << |window_bits| bytes */
+static uint32_t compress_message(int window_bits, uint32_t dict_len) {
+    zng_stream strm;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = zng_deflateInit2(&strm, 6, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK || zng_deflateSetDictionary(&strm, dictionary, dict_len) != Z_OK) {
+        fprintf(stderr, "deflate setup failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    strm.next_in = message;
+    strm.avail_in = MESSAGE_SIZE;
+    strm.next_out = compr;
+    strm.avail_out = sizeof(compr);
+    ret = zng_deflate(&strm, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    zng_deflateEnd(&strm);
+    return (uint32_t)strm.total_out;
+}
+
+/* Inflate with the dictionary attached, out_chunk bytes of output at a time */
+static void inflate_check(zng_stream *strm, uint32_t compr_len, int window_bits, uint32_t dict_len,
+                          uint32_t out_chunk) {
+    int ret;
+
+    if (window_bits < 0 && zng_inflateAttachDictionary(strm, dictionary, dict_len) != Z_OK) {
+        fprintf(stderr, "inflateAttachDictionary() failed for a raw stream\n");
+        exit(EXIT_FAILURE);
+    }
+    strm->next_in = compr;
+    strm->avail_in = compr_len;
+    strm->next_out = uncompr;
+    strm->avail_out = 0;
+    do {
+        strm->avail_out = (uint32_t)(uncompr + sizeof(uncompr) - strm->next_out);
+        if (strm->avail_out > out_chunk)
+            strm->avail_out = out_chunk;
+        ret = zng_inflate(strm, out_chunk < MESSAGE_SIZE ? Z_NO_FLUSH : Z_FINISH);
+        if (ret == Z_NEED_DICT) {
+            if (zng_inflateAttachDictionary(strm, dictionary, dict_len - 1) != Z_DATA_ERROR ||
+                zng_inflateAttachDictionary(strm, dictionary, dict_len) != Z_OK) {
+                fprintf(stderr, "inflateAttachDictionary() failed for a zlib stream\n");
+                exit(EXIT_FAILURE);
+            }
+            ret = Z_OK;
+        }
+    } while (ret == Z_OK);
+    if (ret != Z_STREAM_END || strm->total_out != MESSAGE_SIZE || memcmp(uncompr, message, MESSAGE_SIZE) != 0) {
+        fprintf(stderr, "inflated message does not match with windowBits %d, dictionary of %u bytes and "
+                "output of %u bytes at a time\n", window_bits, dict_len, out_chunk);
+        exit(EXIT_FAILURE);
+    }
+    if (memcmp(dictionary, pristine, DICT_SIZE) != 0) {
+        fprintf(stderr, "attached dictionary was written\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void check_window(int window_bits, uint32_t dict_len) {
+    static const uint32_t out_chunks[] = { MESSAGE_SIZE, 1, 100, 1000 };
+    uint32_t compr_len, i;
+    zng_stream strm;
+
+    compr_len = compress_message(window_bits, dict_len);
+    memset(&strm, 0, sizeof(strm));
+    if (zng_inflateInit2(&strm, window_bits) != Z_OK) {
+        fprintf(stderr, "inflateInit2() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    /* A stream reset after each message, with a window of its own from the second one on */
+    for (i = 0; i < sizeof(out_chunks) / sizeof(out_chunks[0]); i++) {
+        zng_inflateReset(&strm);
+        inflate_check(&strm, compr_len, window_bits, dict_len, out_chunks[i]);
+    }
+    zng_inflateEnd(&strm);
+}
+
+int main() {
+    static const int window_bits[] = { -15, 15, -10, 10 };
+    unsigned char copy_out[MESSAGE_SIZE];
+    zng_stream strm, copy;
+    uint32_t seed = 1, offset = 0, i, compr_len, dict_len;
+
+    for (i = 0; i < DICT_SIZE; i++)
+        dictionary[i] = (unsigned char)('a' + test_rand(&seed) % 20);
+    memcpy(pristine, dictionary, DICT_SIZE);
+    /* Pieces of the whole dictionary, most of them out of reach of a 1K window */
+    for (i = 0; i < MESSAGE_SIZE; i++) {
+        if (i % 50 == 0)
+            offset = test_rand(&seed) % (DICT_SIZE - 100);
+        message[i] = dictionary[offset + i % 50];
+    }
+
+    for (i = 0; i < sizeof(window_bits) / sizeof(window_bits[0]); i++) {
+        check_window(window_bits[i], DICT_SIZE);
+        check_window(window_bits[i], 500);
+    }
+
+    /* A dictionary set after one is attached amends it */
+    dict_len = 20000;
+    compr_len = compress_message(-15, dict_len);
+    memset(&strm, 0, sizeof(strm));
+    if (zng_inflateInit2(&strm, -15) != Z_OK ||
+        zng_inflateAttachDictionary(&strm, dictionary, dict_len / 2) != Z_OK ||
+        zng_inflateSetDictionary(&strm, dictionary + dict_len / 2, dict_len / 2) != Z_OK) {
+        fprintf(stderr, "inflateSetDictionary() after inflateAttachDictionary() failed\n");
+        return EXIT_FAILURE;
+    }
+    strm.next_in = compr;
+    strm.avail_in = compr_len;
+    strm.next_out = uncompr;
+    strm.avail_out = sizeof(uncompr);
+    if (zng_inflate(&strm, Z_FINISH) != Z_STREAM_END || memcmp(uncompr, message, MESSAGE_SIZE) != 0) {
+        fprintf(stderr, "amended dictionary does not match\n");
+        return EXIT_FAILURE;
+    }
+
+    /* A copy of a stream with an attached dictionary reads it too, after the stream copied it */
+    if (zng_inflateReset(&strm) != Z_OK || zng_inflateAttachDictionary(&strm, dictionary, dict_len) != Z_OK ||
+        zng_inflateCopy(&copy, &strm) != Z_OK) {
+        fprintf(stderr, "inflateCopy() failed\n");
+        return EXIT_FAILURE;
+    }
+    strm.next_in = compr;
+    strm.avail_in = compr_len;
+    strm.next_out = uncompr;
+    strm.avail_out = 10;
+    if (zng_inflate(&strm, Z_NO_FLUSH) != Z_OK) {
+        fprintf(stderr, "inflate() failed\n");
+        return EXIT_FAILURE;
+    }
+    zng_inflateEnd(&strm);
+    copy.next_in = compr;
+    copy.avail_in = compr_len;
+    copy.next_out = copy_out;
+    copy.avail_out = sizeof(copy_out);
+    if (zng_inflate(&copy, Z_FINISH) != Z_STREAM_END || memcmp(copy_out, message, MESSAGE_SIZE) != 0) {
+        fprintf(stderr, "copy of an inflate stream with an attached dictionary failed\n");
+        return EXIT_FAILURE;
+    }
+    zng_inflateEnd(&copy);
+
+    /* gzip streams take no dictionary */
+    memset(&strm, 0, sizeof(strm));
+    if (zng_inflateInit2(&strm, 31) != Z_OK ||
+        zng_inflateAttachDictionary(&strm, dictionary, DICT_SIZE) != Z_STREAM_ERROR ||
+        zng_inflateAttachDictionary(NULL, dictionary, DICT_SIZE) != Z_STREAM_ERROR) {
+        fprintf(stderr, "gzip stream took a dictionary\n");
+        return EXIT_FAILURE;
+    }
+    zng_inflateEnd(&strm);
+    return EXIT_SUCCESS;
+}
@@ -211,10 +211,55 @@ void inflate_params(FILE *fin, FILE *fout, int32_t read_buf_size, int32_t write_
     free(write_buf);
 }
 
+#ifndef ZLIB_COMPAT
+/* ===========================================================================
+ * zng_transcode() of the whole input to the given level
+ */
+void transcode_params(FILE *fin, FILE *fout, int32_t read_buf_size, int32_t level, int32_t window_bits) {
+    uint8_t *source = NULL, *dest = NULL;
+    size_t source_size = 0, source_len = 0, dest_len;
+    int err;
+
+    do {
+        if (source_len == source_size) {
+            source_size += read_buf_size;
+            source = (uint8_t *)realloc(source, source_size);
+            if (source == NULL) {
+                fprintf(stderr, "failed to create read buffer (%zu)\n", source_size);
+                return;
+            }
+        }
+        source_len += fread(source + source_len, 1, source_size - source_len, fin);
+    } while (!feof(fin) && !ferror(fin));
+
+    /* The size of the output is not known up front, grow it until it fits */
+    dest_len = source_len + 1024;
+    do {
+        size_t in_len = source_len;
+
+        free(dest);
+        dest_len *= 2;
+        dest = (uint8_t *)malloc(dest_len);
+        if (dest == NULL) {
+            fprintf(stderr, "failed to create write buffer (%zu)\n", dest_len);
+            free(source);
+            return;
+        }
+        err = zng_transcode(dest, &dest_len, source, &in_len, level, window_bits);
+    } while (err == Z_BUF_ERROR);
+    CHECK_ERR(err, "transcode");
+
+    fwrite(dest, 1, dest_len, fout);
+    free(source);
+    free(dest);
+}
+#endif
+
 void show_help(void) {
-    printf("Usage: minideflate [-c] [-f|-h|-R|-F] [-m level] [-r/-t size] [-s flush] [-w bits] [-0 to -9] [input file]\n\n" \
+    printf("Usage: minideflate [-c] [-d|-T] [-f|-h|-R|-F] [-m level] [-r/-t size] [-s flush] [-w bits] [-0 to -9] [input file]\n\n" \
            "  -c : write to standard output\n" \
            "  -d : decompress\n" \
+           "  -T : recompress a compressed input at the given level\n" \
            "  -f : compress with Z_FILTERED\n" \
            "  -h : compress with Z_HUFFMAN_ONLY\n" \
            "  -R : compress with Z_RLE\n" \
@@ -238,6 +283,9 @@ int main(int argc, char **argv) {
     int32_t flush = Z_NO_FLUSH;
     uint8_t copyout = 0;
     uint8_t uncompr = 0;
+#ifndef ZLIB_COMPAT
+    uint8_t transcode = 0;
+#endif
     char out_file[320];
     FILE *fin = stdin;
     FILE *fout = stdout;
@@ -257,6 +305,10 @@ int main(int argc, char **argv) {
             copyout = 1;
         else if (strcmp(argv[i], "-d") == 0)
             uncompr = 1;
+#ifndef ZLIB_COMPAT
+        else if (strcmp(argv[i], "-T") == 0)
+            transcode = 1;
+#endif
         else if (strcmp(argv[i], "-f") == 0)
             strategy = Z_FILTERED;
         else if (strcmp(argv[i], "-h") == 0)
@@ -293,6 +345,11 @@ int main(int argc, char **argv) {
         }
     }
 
+#ifndef ZLIB_COMPAT
+    if (transcode) {
+        transcode_params(fin, fout, read_buf_size, level, window_bits);
+    } else
+#endif
     if (uncompr) {
         inflate_params(fin, fout, read_buf_size, write_buf_size, window_bits, flush);
     } else {
@@ -0,0 +1,174 @@
+/* test_shared.h -- input generators and checks shared by the tests
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Include after zbuild.h and zlib.h or zlib-ng.h.
+ */
+
+#ifndef TEST_SHARED_H_
+#define TEST_SHARED_H_
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Linear congruential generator, giving the same input on every platform */
+static inline uint32_t test_rand(uint32_t *seed) {
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 16;
+}
+
+/* Text made of a few words */
+static inline void test_fill_text(unsigned char *buf, size_t len, uint32_t *seed) {
+    static const char *words[] = { "the ", "block ", "of ", "data ", "is ", "compressed ", "with ",
+                                   "matches ", "and ", "literals ", ". ", "\n" };
+    size_t pos = 0;
+
+    while (pos < len) {
+        const char *word = words[test_rand(seed) % (sizeof(words) / sizeof(words[0]))];
+        while (*word && pos < len)
+            buf[pos++] = (unsigned char)*word++;
+    }
+}
+
+/* Binary records of a counter and a few small fields, which share short byte
+ * sequences at every offset */
+static inline void test_fill_records(unsigned char *buf, size_t len, uint32_t *seed) {
+    unsigned char record[8];
+    size_t pos, i;
+
+    for (pos = 0; pos < len; pos += sizeof(record)) {
+        record[0] = (unsigned char)pos;
+        record[1] = (unsigned char)(pos >> 8);
+        record[2] = (unsigned char)(pos >> 16);
+        record[3] = 0;
+        record[4] = (unsigned char)(test_rand(seed) % 4);
+        record[5] = 0;
+        record[6] = (unsigned char)test_rand(seed);
+        record[7] = 0;
+        for (i = 0; i < sizeof(record) && pos + i < len; i++)
+            buf[pos + i] = record[i];
+    }
+}
+
+/* Runs of a byte value or of short periods */
+static inline void test_fill_runs(unsigned char *buf, size_t len, uint32_t *seed) {
+    size_t pos = 0;
+
+    while (pos < len) {
+        unsigned char value = (unsigned char)test_rand(seed);
+        uint32_t period = 1 + test_rand(seed) % 4, run = 64 + test_rand(seed) % 512, i;
+        for (i = 0; i < run && pos < len; i++, pos++)
+            buf[pos] = (unsigned char)(value + i % period);
+    }
+}
+
+static inline void test_fill_random(unsigned char *buf, size_t len, uint32_t *seed) {
+    size_t pos;
+
+    for (pos = 0; pos < len; pos++)
+        buf[pos] = (unsigned char)test_rand(seed);
+}
+
+/* Fill buf with segments of the kinds of input listed in kinds in turn: 't' for
+ * text, 'b' for binary records, 'r' for runs and 'x' for random bytes */
+static inline void test_fill_mixed(unsigned char *buf, size_t len, size_t segment, const char *kinds,
+                                   uint32_t *seed) {
+    size_t pos, n, count = strlen(kinds);
+
+    for (pos = 0; pos < len; pos += n) {
+        n = len - pos < segment ? len - pos : segment;
+        switch (kinds[pos / segment % count]) {
+        case 't':
+            test_fill_text(buf + pos, n, seed);
+            break;
+        case 'b':
+            test_fill_records(buf + pos, n, seed);
+            break;
+        case 'r':
+            test_fill_runs(buf + pos, n, seed);
+            break;
+        default:
+            test_fill_random(buf + pos, n, seed);
+            break;
+        }
+    }
+}
+
+/* Compress the in_len bytes at in into out with the parameters of deflateInit2(),
+ * passing the input and taking the output in pieces of at most chunk bytes and
+ * calling deflate() with flush after each piece of input but the last, and
+ * return the length of the compressed data */
+static inline size_t test_deflate(const unsigned char *in, size_t in_len, unsigned char *out, size_t out_size,
+                                  int level, int window_bits, int mem_level, int strategy, uint32_t chunk,
+                                  int flush) {
+    PREFIX3(stream) strm;
+    size_t left = in_len, out_len;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, window_bits, mem_level, strategy);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    strm.next_in = (unsigned char *)in;
+    strm.next_out = out;
+    do {
+        strm.avail_in = (uint32_t)MIN(left, chunk);
+        left -= strm.avail_in;
+        do {
+            out_len = (size_t)(strm.next_out - out);
+            if (out_len == out_size) {
+                fprintf(stderr, "deflate() output does not fit in %zu bytes\n", out_size);
+                exit(EXIT_FAILURE);
+            }
+            strm.avail_out = (uint32_t)MIN(out_size - out_len, chunk);
+            ret = PREFIX(deflate)(&strm, left ? flush : Z_FINISH);
+            if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+                fprintf(stderr, "deflate() failed with code %d\n", ret);
+                exit(EXIT_FAILURE);
+            }
+        } while (strm.avail_out == 0);
+    } while (left);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() did not finish at level %d with strategy %d\n", level, strategy);
+        exit(EXIT_FAILURE);
+    }
+    out_len = (size_t)(strm.next_out - out);
+    PREFIX(deflateEnd)(&strm);
+    return out_len;
+}
+
+/* Inflate the compr_len bytes at compr, and exit with a message made of fmt
+ * unless that gives back exactly the expect_len bytes at expect */
+static inline void test_inflate_check(const unsigned char *compr, size_t compr_len, int window_bits,
+                                      const unsigned char *expect, size_t expect_len, const char *fmt, ...) {
+    PREFIX3(stream) strm;
+    unsigned char *out = (unsigned char *)malloc(expect_len + 1);
+    va_list args;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    if (out == NULL || PREFIX(inflateInit2)(&strm, window_bits) != Z_OK) {
+        fprintf(stderr, "inflateInit2() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    strm.next_in = (unsigned char *)compr;
+    strm.avail_in = (uint32_t)compr_len;
+    strm.next_out = out;
+    strm.avail_out = (uint32_t)expect_len + 1;
+    ret = PREFIX(inflate)(&strm, Z_FINISH);
+    if (ret != Z_STREAM_END || strm.total_out != expect_len || memcmp(out, expect, expect_len) != 0) {
+        fprintf(stderr, "inflated data does not match ");
+        va_start(args, fmt);
+        vfprintf(stderr, fmt, args);
+        va_end(args);
+        fprintf(stderr, " with window bits %d\n", window_bits);
+        exit(EXIT_FAILURE);
+    }
+    PREFIX(inflateEnd)(&strm);
+    free(out);
+}
+
+#endif
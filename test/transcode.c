@@ -0,0 +1,200 @@
+/* Test that zng_transcode() round trips raw, zlib and gzip streams between
+ * levels, keeps the gzip header, and refuses corrupted or incomplete sources.
+ */
+
+#include "zbuild.h"
+#include "zlib-ng.h"
+
+#include "test_shared.h"
+
+#define TRANSCODE_SIZE    (1024 * 1024)
+#define TRANSCODE_SEGMENT 65536
+
+static unsigned char next_in[TRANSCODE_SIZE];
+static unsigned char source[TRANSCODE_SIZE * 2];
+static unsigned char dest[TRANSCODE_SIZE * 2];
+
+/* Compress the first len bytes of next_in into source */
+static size_t compress_source(int level, int window_bits, uint32_t len, zng_gz_header *head) {
+    zng_stream strm;
+    size_t source_len;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    ret = zng_deflateInit2(&strm, level, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        fprintf(stderr, "deflateInit2() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    if (head != NULL && zng_deflateSetHeader(&strm, head) != Z_OK) {
+        fprintf(stderr, "deflateSetHeader() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    strm.next_in = next_in;
+    strm.avail_in = len;
+    strm.next_out = source;
+    strm.avail_out = sizeof(source);
+    ret = zng_deflate(&strm, Z_FINISH);
+    if (ret != Z_STREAM_END) {
+        fprintf(stderr, "deflate() failed with code %d\n", ret);
+        exit(EXIT_FAILURE);
+    }
+    source_len = strm.total_out;
+    zng_deflateEnd(&strm);
+    return source_len;
+}
+
+/* Check the data and, for gzip, the header of the transcoded stream in dest */
+static void inflate_check(size_t dest_len, int window_bits, uint32_t len, int from, int to) {
+    zng_stream strm;
+    zng_gz_header head;
+    unsigned char name[64];
+    unsigned char out[1];
+
+    test_inflate_check(dest, dest_len, window_bits, next_in, len, "transcoded from level %d to %d", from, to);
+    if (window_bits <= 15)
+        return;
+    memset(&strm, 0, sizeof(strm));
+    memset(&head, 0, sizeof(head));
+    head.name = name;
+    head.name_max = sizeof(name);
+    if (zng_inflateInit2(&strm, window_bits) != Z_OK || zng_inflateGetHeader(&strm, &head) != Z_OK) {
+        fprintf(stderr, "inflateInit2() failed\n");
+        exit(EXIT_FAILURE);
+    }
+    /* Z_BLOCK returns after the header */
+    strm.next_in = dest;
+    strm.avail_in = (uint32_t)dest_len;
+    strm.next_out = out;
+    strm.avail_out = sizeof(out);
+    if (zng_inflate(&strm, Z_BLOCK) != Z_OK || head.done != 1 || strcmp((char *)name, "transcode.txt") != 0 ||
+        head.time != 1234) {
+        fprintf(stderr, "gzip header was not kept from level %d to %d\n", from, to);
+        exit(EXIT_FAILURE);
+    }
+    zng_inflateEnd(&strm);
+}
+
+/* Transcode a source compressed at from to level to, with trailing garbage that must be left unread */
+static void transcode_check(int from, int to, int window_bits, uint32_t len) {
+    zng_gz_header head;
+    size_t source_len, used, dest_len;
+    int ret;
+
+    memset(&head, 0, sizeof(head));
+    head.name = (unsigned char *)"transcode.txt";
+    head.time = 1234;
+    source_len = compress_source(from, window_bits, len, window_bits > 15 ? &head : NULL);
+    memset(source + source_len, 0xa5, 16);
+
+    used = source_len + 16;
+    dest_len = sizeof(dest);
+    ret = zng_transcode(dest, &dest_len, source, &used, to, window_bits > 0 ? (window_bits & 15) + 32 : window_bits);
+    if (ret != Z_OK || used != source_len) {
+        fprintf(stderr, "transcode() failed with code %d from level %d to %d with windowBits %d\n",
+                ret, from, to, window_bits);
+        exit(EXIT_FAILURE);
+    }
+    inflate_check(dest_len, window_bits, len, from, to);
+}
+
+/* Append the n bits of value to the raw stream at source, from bit *bit on,
+ * reversed for a Huffman code */
+static void put_bits(size_t *bit, uint32_t value, unsigned n, int huffman) {
+    unsigned i, b;
+
+    for (i = 0; i < n; i++, (*bit)++) {
+        b = huffman ? (value >> (n - 1 - i)) & 1 : (value >> i) & 1;
+        source[*bit / 8] = (unsigned char)(source[*bit / 8] | (b << (*bit % 8)));
+    }
+}
+
+/* Transcode a raw stream of a stored block of 32768 bytes and a fixed block
+ * with a match of 258 bytes 32768 back, which deflate cannot reach */
+static void transcode_far(int to) {
+    size_t bit, used, dest_len;
+    int ret;
+
+    memset(source, 0, 5 + 32768 + 8);
+    source[1] = 0x00;
+    source[2] = 0x80;
+    source[3] = 0xff;
+    source[4] = 0x7f;
+    memcpy(source + 5, next_in, 32768);
+    memcpy(next_in + 32768, next_in, 258);
+    bit = (5 + 32768) * 8;
+    put_bits(&bit, 1, 1, 0);            /* last block */
+    put_bits(&bit, 1, 2, 0);            /* fixed codes */
+    put_bits(&bit, 0xc5, 8, 1);         /* length 258 */
+    put_bits(&bit, 29, 5, 1);           /* distance 24577 */
+    put_bits(&bit, 8191, 13, 0);        /* + 8191 */
+    put_bits(&bit, 0, 7, 1);            /* end of block */
+
+    used = (bit + 7) / 8;
+    dest_len = sizeof(dest);
+    ret = zng_transcode(dest, &dest_len, source, &used, to, -15);
+    if (ret != Z_OK || used != (bit + 7) / 8) {
+        fprintf(stderr, "transcode() of a match 32768 back failed with code %d at level %d\n", ret, to);
+        exit(EXIT_FAILURE);
+    }
+    inflate_check(dest_len, -15, 32768 + 258, 6, to);
+}
+
+static void check_error(int expected, size_t source_len, size_t dest_len, int window_bits, const char *what) {
+    int ret = zng_transcode(dest, &dest_len, source, &source_len, 9, window_bits);
+    if (ret != expected) {
+        fprintf(stderr, "transcode() of %s returned %d instead of %d\n", what, ret, expected);
+        exit(EXIT_FAILURE);
+    }
+}
+
+int main() {
+    static const int levels[][2] = { {1, 9}, {9, 1}, {6, 9}, {1, 6}, {1, 3}, {0, 6} };
+    static const int window_bits[] = { -15, 15, 31, -10, 10 };
+    uint32_t seed = 1, i, j;
+    zng_stream strm;
+    size_t source_len;
+
+    /* Alternate between text and binary records of a counter and a few small fields */
+    test_fill_mixed(next_in, TRANSCODE_SIZE, TRANSCODE_SEGMENT, "tb", &seed);
+
+    for (i = 0; i < sizeof(levels) / sizeof(levels[0]); i++) {
+        for (j = 0; j < sizeof(window_bits) / sizeof(window_bits[0]); j++)
+            transcode_check(levels[i][0], levels[i][1], window_bits[j], TRANSCODE_SIZE);
+    }
+    transcode_check(6, 9, 15, 0);
+    transcode_check(6, 9, 31, 100);
+    for (i = 1; i <= 9; i += 4)
+        transcode_far((int)i);
+
+    /* Corrupted trailers, truncated sources and a full output are refused */
+    source_len = compress_source(1, 15, TRANSCODE_SIZE, NULL);
+    source[source_len - 1] ^= 1;
+    check_error(Z_DATA_ERROR, source_len, sizeof(dest), 15, "a corrupted zlib trailer");
+    source_len = compress_source(1, 31, TRANSCODE_SIZE, NULL);
+    source[source_len - 5] ^= 1;
+    check_error(Z_DATA_ERROR, source_len, sizeof(dest), 31, "a corrupted gzip length");
+    source_len = compress_source(6, -15, TRANSCODE_SIZE, NULL);
+    check_error(Z_DATA_ERROR, source_len / 2, sizeof(dest), -15, "a truncated raw stream");
+    check_error(Z_BUF_ERROR, source_len, 1000, -15, "a full output");
+    check_error(Z_STREAM_ERROR, source_len, sizeof(dest), 7, "an invalid windowBits");
+    source_len = compress_source(6, 10, TRANSCODE_SIZE, NULL);
+    check_error(Z_DATA_ERROR, source_len, sizeof(dest), 9, "a window larger than windowBits");
+
+    memset(&strm, 0, sizeof(strm));
+    if (zng_deflateInit(&strm, 6) != Z_OK || zng_deflateSetDictionary(&strm, next_in, 1000) != Z_OK) {
+        fprintf(stderr, "deflateSetDictionary() failed\n");
+        return EXIT_FAILURE;
+    }
+    strm.next_in = next_in;
+    strm.avail_in = 1000;
+    strm.next_out = source;
+    strm.avail_out = sizeof(source);
+    if (zng_deflate(&strm, Z_FINISH) != Z_STREAM_END) {
+        fprintf(stderr, "deflate() with a dictionary failed\n");
+        return EXIT_FAILURE;
+    }
+    check_error(Z_DATA_ERROR, strm.total_out, sizeof(dest), 15, "a source with a dictionary");
+    zng_deflateEnd(&strm);
+    return EXIT_SUCCESS;
+}
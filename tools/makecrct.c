@@ -11,13 +11,22 @@
 
 static uint32_t crc_table[8][256];
 static uint32_t crc_comb[GF2_DIM][GF2_DIM];
+static uint32_t crc_braid_table_w8[8][256];
+static uint64_t crc_braid_big_table_w8[8][256];
+static uint32_t crc_braid_table_w4[4][256];
+static uint32_t crc_braid_big_table_w4[4][256];
+
+#define POLY 0xedb88320     /* p(x) reflected, with x^32 implied */
 
 static void gf2_matrix_square(uint32_t *square, const uint32_t *mat);
 static void make_crc_table(void);
 static void make_crc_combine_table(void);
+static void make_crc_braid_table(void);
 static void print_crc_table(void);
 static void print_crc_combine_table(void);
+static void print_crc_braid_table(void);
 static void write_table(const uint32_t *, int);
+static void write_table64(const uint64_t *, int);
 
 
 /* ========================================================================= */
@@ -115,6 +124,75 @@ static void make_crc_combine_table(void) {
         gf2_matrix_square(crc_comb[n], crc_comb[n - 1]);
 }
 
+/* =========================================================================
+  Return a(x) multiplied by b(x) modulo p(x), where p(x) is the CRC polynomial,
+  reflected. For speed, this requires that a not be zero.
+*/
+static uint32_t multmodp(uint32_t a, uint32_t b) {
+    uint32_t m, p;
+
+    m = (uint32_t)1 << 31;
+    p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0)
+                break;
+        }
+        m >>= 1;
+        b = b & 1 ? (b >> 1) ^ POLY : b >> 1;
+    }
+    return p;
+}
+
+/* Return x^n modulo p(x). */
+static uint32_t x8nmodp(uint32_t n) {
+    uint32_t p, sq;
+
+    p = (uint32_t)1 << 31;              /* x^0 == 1 */
+    sq = (uint32_t)1 << 23;             /* x^8 */
+    while (n) {
+        if (n & 1)
+            p = multmodp(sq, p);
+        sq = multmodp(sq, sq);
+        n >>= 1;
+    }
+    return p;
+}
+
+/* =========================================================================
+  Generate the little and big-endian braid tables for BRAID_N braids of w
+  bytes each. Entry [k][i] is the CRC of the byte value i positioned at byte
+  k of a word, advanced over the remaining bytes of that word and the
+  following BRAID_N - 1 words, which lets each of the BRAID_N lanes be
+  carried forward independently by a whole block of BRAID_N * w bytes.
+*/
+static void braid(uint32_t ltl[][256], uint64_t big64[][256], uint32_t big32[][256], int w) {
+    int k;
+    uint32_t i, p, q;
+
+    for (k = 0; k < w; k++) {
+        p = x8nmodp(BRAID_N * w + 3 - k);
+        ltl[k][0] = 0;
+        if (big64 != NULL)
+            big64[w - 1 - k][0] = 0;
+        else
+            big32[w - 1 - k][0] = 0;
+        for (i = 1; i < 256; i++) {
+            ltl[k][i] = q = multmodp(i << 24, p);
+            if (big64 != NULL)
+                big64[w - 1 - k][i] = (uint64_t)ZSWAP32(q) << 32;
+            else
+                big32[w - 1 - k][i] = ZSWAP32(q);
+        }
+    }
+}
+
+static void make_crc_braid_table(void) {
+    braid(crc_braid_table_w8, crc_braid_big_table_w8, NULL, 8);
+    braid(crc_braid_table_w4, NULL, crc_braid_big_table_w4, 4);
+}
+
 static void write_table(const uint32_t *table, int k) {
     int n;
 
@@ -124,6 +202,15 @@ static void write_table(const uint32_t *table, int k) {
                 n == k - 1 ? "\n" : (n % 5 == 4 ? ",\n" : ", "));
 }
 
+static void write_table64(const uint64_t *table, int k) {
+    int n;
+
+    for (n = 0; n < k; n++)
+        printf("%s0x%016" PRIx64 "%s", n % 3 ? "" : "    ",
+                table[n],
+                n == k - 1 ? "\n" : (n % 3 == 2 ? ",\n" : ", "));
+}
+
 static void print_crc_table(void) {
     int k;
     printf("#ifndef CRC32_TBL_H_\n");
@@ -164,11 +251,66 @@ static void print_crc_combine_table(void) {
     printf("#endif /* CRC32_COMB_TBL_H_ */\n");
 }
 
-// The output of this application can be piped out to recreate crc32.h
+static void print_crc_braid_table(void) {
+    int k;
+    printf("#ifndef CRC32_BRAID_TBL_H_\n");
+    printf("#define CRC32_BRAID_TBL_H_\n\n");
+    printf("/* crc32_braid_tbl.h -- tables for braided CRC calculation\n");
+    printf(" * Generated automatically by makecrct.c\n */\n\n");
+
+    /* print braid tables for 64-bit words */
+    printf("#if BRAID_W == 8\n\n");
+    printf("static const uint32_t ");
+    printf("crc_braid_table[8][256] =\n{\n  {\n");
+    write_table(crc_braid_table_w8[0], 256);
+    for (k = 1; k < 8; k++) {
+        printf("  },\n  {\n");
+        write_table(crc_braid_table_w8[k], 256);
+    }
+    printf("  }\n};\n\n");
+
+    printf("static const uint64_t ");
+    printf("crc_braid_big_table[8][256] =\n{\n  {\n");
+    write_table64(crc_braid_big_table_w8[0], 256);
+    for (k = 1; k < 8; k++) {
+        printf("  },\n  {\n");
+        write_table64(crc_braid_big_table_w8[k], 256);
+    }
+    printf("  }\n};\n\n");
+
+    /* print braid tables for 32-bit words */
+    printf("#else /* BRAID_W == 4 */\n\n");
+    printf("static const uint32_t ");
+    printf("crc_braid_table[4][256] =\n{\n  {\n");
+    write_table(crc_braid_table_w4[0], 256);
+    for (k = 1; k < 4; k++) {
+        printf("  },\n  {\n");
+        write_table(crc_braid_table_w4[k], 256);
+    }
+    printf("  }\n};\n\n");
+
+    printf("static const uint32_t ");
+    printf("crc_braid_big_table[4][256] =\n{\n  {\n");
+    write_table(crc_braid_big_table_w4[0], 256);
+    for (k = 1; k < 4; k++) {
+        printf("  },\n  {\n");
+        write_table(crc_braid_big_table_w4[k], 256);
+    }
+    printf("  }\n};\n\n");
+    printf("#endif /* BRAID_W */\n\n");
+
+    printf("#endif /* CRC32_BRAID_TBL_H_ */\n");
+}
+
+// The output of this application can be piped out to recreate crc32_tbl.h,
+// crc32_comb_tbl.h (-c) and crc32_braid_tbl.h (-b)
 int main(int argc, char *argv[]) {
     if (argc > 1 && strcmp(argv[1], "-c") == 0) {
         make_crc_combine_table();
         print_crc_combine_table();
+    } else if (argc > 1 && strcmp(argv[1], "-b") == 0) {
+        make_crc_braid_table();
+        print_crc_braid_table();
     } else {
         make_crc_table();
         print_crc_table();
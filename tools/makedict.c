@@ -0,0 +1,401 @@
+/* makedict.c -- build a preset dictionary from sample messages
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Every sample file is one message, or is cut into messages of the size given
+ * with -m. The dictionary is made of the segments of the messages with the most
+ * 8 byte strings that other messages repeat, each string counted once, and the
+ * best segments are placed last, where deflate reaches them with the shortest
+ * distances and they stay in the window the longest. Every fifth message is
+ * left out of the training and used to report the compressed size and speed
+ * with and without the dictionary.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "zbuild.h"
+#ifdef ZLIB_COMPAT
+#  include "zlib.h"
+#else
+#  include "zlib-ng.h"
+#endif
+
+#define STRING_LEN   8      /* length of the repeated strings counted */
+#define SEGMENT_LEN  64     /* length of the segments picked */
+#define SEGMENT_STEP 16     /* distance between the starts of segments */
+#define DICT_HASH_BITS 22
+#define DICT_HASH_SIZE (1 << DICT_HASH_BITS)
+#define EVAL_EVERY   5      /* one message in EVAL_EVERY is left out of the training */
+#define EVAL_TIME    (CLOCKS_PER_SEC / 4)
+
+typedef struct {
+    size_t start;           /* offset in the corpus */
+    size_t len;
+} message;
+
+typedef struct {
+    uint64_t score;
+    size_t start;           /* offset in the corpus */
+    uint32_t len;
+} segment;
+
+static unsigned char *corpus;
+static size_t corpus_len;
+static message *messages;
+static size_t message_count;
+static uint32_t *counts;    /* messages each string appears in, by hash */
+static uint32_t *seen;      /* last message each string was counted for, plus one */
+
+static void show_help(void) {
+    printf("Usage: makedict [-s size] [-m size] [-l level] [-o file] sample...\n\n" \
+           "  -s : dictionary size (at most 32768, default 32768)\n" \
+           "  -m : cut the samples into messages of this size (default whole files)\n" \
+           "  -l : compression level to report with (default 6)\n" \
+           "  -o : file to write the dictionary to\n\n");
+}
+
+static void *xalloc(size_t size) {
+    void *p = malloc(size ? size : 1);
+    if (p == NULL) {
+        fprintf(stderr, "makedict: out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+/* Append a sample to the corpus, as one message or cut into messages of message_size bytes */
+static void read_sample(const char *name, size_t message_size) {
+    static size_t corpus_size = 0, messages_size = 0;
+    FILE *f = fopen(name, "rb");
+    size_t len, pos, got;
+    long end;
+
+    if (f == NULL || fseek(f, 0, SEEK_END) != 0 || (end = ftell(f)) < 0 || fseek(f, 0, SEEK_SET) != 0) {
+        fprintf(stderr, "makedict: cannot read %s\n", name);
+        exit(1);
+    }
+    len = (size_t)end;
+    if (corpus_len + len + STRING_LEN > corpus_size) {
+        corpus_size = (corpus_len + len + STRING_LEN) * 2;
+        corpus = (unsigned char *)realloc(corpus, corpus_size);
+        if (corpus == NULL) {
+            fprintf(stderr, "makedict: out of memory\n");
+            exit(1);
+        }
+    }
+    got = fread(corpus + corpus_len, 1, len, f);
+    fclose(f);
+    if (got != len) {
+        fprintf(stderr, "makedict: cannot read %s\n", name);
+        exit(1);
+    }
+    for (pos = 0; pos < len; pos += message_size ? message_size : len) {
+        if (message_count == messages_size) {
+            messages_size = messages_size ? messages_size * 2 : 1024;
+            messages = (message *)realloc(messages, messages_size * sizeof(message));
+            if (messages == NULL) {
+                fprintf(stderr, "makedict: out of memory\n");
+                exit(1);
+            }
+        }
+        messages[message_count].start = corpus_len + pos;
+        messages[message_count].len = message_size && len - pos > message_size ? message_size : len - pos;
+        message_count++;
+    }
+    corpus_len += len;
+}
+
+static int training(size_t i) {
+    return message_count < 2 * EVAL_EVERY || i % EVAL_EVERY != EVAL_EVERY - 1;
+}
+
+/* Too few messages to leave some out are all used for both */
+static int evaluation(size_t i) {
+    return message_count < 2 * EVAL_EVERY || !training(i);
+}
+
+static uint32_t hash_string(const unsigned char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return (uint32_t)((v * 0x9e3779b97f4a7c15ULL) >> (64 - DICT_HASH_BITS));
+}
+
+/* Count the training messages each string appears in */
+static void count_strings(void) {
+    size_t i, pos;
+
+    counts = (uint32_t *)xalloc(DICT_HASH_SIZE * sizeof(uint32_t));
+    seen = (uint32_t *)xalloc(DICT_HASH_SIZE * sizeof(uint32_t));
+    memset(counts, 0, DICT_HASH_SIZE * sizeof(uint32_t));
+    memset(seen, 0, DICT_HASH_SIZE * sizeof(uint32_t));
+    for (i = 0; i < message_count; i++) {
+        if (!training(i))
+            continue;
+        for (pos = 0; pos + STRING_LEN <= messages[i].len; pos++) {
+            uint32_t h = hash_string(corpus + messages[i].start + pos);
+            if (seen[h] != (uint32_t)i + 1) {
+                seen[h] = (uint32_t)i + 1;
+                counts[h]++;
+            }
+        }
+    }
+}
+
+/* Number of other messages that repeat the strings of a segment */
+static uint64_t score_segment(const segment *seg) {
+    uint64_t score = 0;
+    uint32_t pos;
+
+    for (pos = 0; pos + STRING_LEN <= seg->len; pos++) {
+        uint32_t count = counts[hash_string(corpus + seg->start + pos)];
+        if (count > 1)
+            score += count - 1;
+    }
+    return score;
+}
+
+/* Binary max-heap of segments by score */
+static void heap_push(segment *heap, size_t *n, segment seg) {
+    size_t i = (*n)++;
+    while (i > 0 && heap[(i - 1) / 2].score < seg.score) {
+        heap[i] = heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap[i] = seg;
+}
+
+static segment heap_pop(segment *heap, size_t *n) {
+    segment top = heap[0], last = heap[--*n];
+    size_t i = 0, child;
+
+    while ((child = 2 * i + 1) < *n) {
+        if (child + 1 < *n && heap[child + 1].score > heap[child].score)
+            child++;
+        if (heap[child].score <= last.score)
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (*n)
+        heap[i] = last;
+    return top;
+}
+
+/* Pick the segments with the highest scores, scoring again those that lost strings to
+ * the segments picked before them, and write them from last to first picked */
+static uint32_t build_dictionary(unsigned char *dict, uint32_t dict_size) {
+    segment *heap, *picked, seg;
+    size_t heap_len = 0, picked_len = 0, i, pos;
+    uint32_t len = 0, n;
+
+    heap = (segment *)xalloc((corpus_len / SEGMENT_STEP + message_count) * sizeof(segment));
+    for (i = 0; i < message_count; i++) {
+        if (!training(i))
+            continue;
+        for (pos = 0; pos + STRING_LEN <= messages[i].len; pos += SEGMENT_STEP) {
+            seg.start = messages[i].start + pos;
+            seg.len = (uint32_t)MIN(SEGMENT_LEN, messages[i].len - pos);
+            seg.score = score_segment(&seg);
+            if (seg.score)
+                heap_push(heap, &heap_len, seg);
+        }
+    }
+
+    picked = (segment *)xalloc((dict_size / STRING_LEN + 1) * sizeof(segment));
+    while (heap_len && len < dict_size) {
+        seg = heap_pop(heap, &heap_len);
+        seg.score = score_segment(&seg);
+        if (seg.score == 0)
+            continue;
+        if (heap_len && seg.score < heap[0].score) {
+            heap_push(heap, &heap_len, seg);
+            continue;
+        }
+        /* Strings are only worth having once */
+        for (n = 0; n + STRING_LEN <= seg.len; n++)
+            counts[hash_string(corpus + seg.start + n)] = 0;
+        seg.len = MIN(seg.len, dict_size - len);
+        picked[picked_len++] = seg;
+        len += seg.len;
+    }
+
+    pos = len;
+    for (i = 0; i < picked_len; i++) {
+        pos -= picked[i].len;
+        memcpy(dict + pos, corpus + picked[i].start, picked[i].len);
+    }
+    free(picked);
+    free(heap);
+    return len;
+}
+
+/* Compress and inflate the evaluation messages with the dictionary until enough time
+ * passed, and return their compressed size and the speeds in MB/s */
+static size_t evaluate(const unsigned char *dict, uint32_t dict_len, int level, double *deflate_speed,
+                       double *inflate_speed) {
+    PREFIX3(stream) strm;
+    unsigned char *compr, *out;
+    size_t *compr_lens, max_len = 0, compr_size = 0, compr_len = 0, total = 0, bytes, i, passes;
+    clock_t start, elapsed;
+    int ret;
+
+    memset(&strm, 0, sizeof(strm));
+    if (PREFIX(deflateInit2)(&strm, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        fprintf(stderr, "makedict: deflateInit2() failed\n");
+        exit(1);
+    }
+    for (i = 0; i < message_count; i++) {
+        max_len = MAX(max_len, messages[i].len);
+        compr_size += (size_t)PREFIX(deflateBound)(&strm, (unsigned long)messages[i].len);
+    }
+    compr = (unsigned char *)xalloc(compr_size);
+    compr_lens = (size_t *)xalloc(message_count * sizeof(size_t));
+    out = (unsigned char *)xalloc(max_len);
+    start = clock();
+    passes = 0;
+    do {
+        compr_len = total = 0;
+        for (i = 0; i < message_count; i++) {
+            if (!evaluation(i))
+                continue;
+            PREFIX(deflateReset)(&strm);
+            if (dict_len)
+                PREFIX(deflateSetDictionary)(&strm, dict, dict_len);
+            strm.next_in = corpus + messages[i].start;
+            strm.avail_in = (uint32_t)messages[i].len;
+            for (;;) {
+                strm.next_out = compr + compr_len + strm.total_out;
+                strm.avail_out = (uint32_t)MIN(compr_size - compr_len - strm.total_out, UINT32_MAX);
+                ret = PREFIX(deflate)(&strm, Z_FINISH);
+                if (ret != Z_OK && ret != Z_BUF_ERROR)
+                    break;
+                /* Level 1 can go past deflateBound() on incompressible messages */
+                compr_size *= 2;
+                compr = (unsigned char *)realloc(compr, compr_size);
+                if (compr == NULL) {
+                    fprintf(stderr, "makedict: out of memory\n");
+                    exit(1);
+                }
+            }
+            if (ret != Z_STREAM_END) {
+                fprintf(stderr, "makedict: deflate() failed\n");
+                exit(1);
+            }
+            compr_lens[i] = (size_t)strm.total_out;
+            compr_len += compr_lens[i];
+            total += messages[i].len;
+        }
+        passes++;
+        elapsed = clock() - start;
+    } while (elapsed < EVAL_TIME);
+    bytes = total * passes;
+    *deflate_speed = (double)bytes / ((double)MAX(elapsed, 1) / CLOCKS_PER_SEC) / 1e6;
+    PREFIX(deflateEnd)(&strm);
+
+    memset(&strm, 0, sizeof(strm));
+    if (PREFIX(inflateInit2)(&strm, -MAX_WBITS) != Z_OK) {
+        fprintf(stderr, "makedict: inflateInit2() failed\n");
+        exit(1);
+    }
+    start = clock();
+    passes = 0;
+    do {
+        const unsigned char *next = compr;
+        for (i = 0; i < message_count; i++) {
+            if (!evaluation(i))
+                continue;
+            PREFIX(inflateReset)(&strm);
+            if (dict_len)
+                PREFIX(inflateSetDictionary)(&strm, dict, dict_len);
+            strm.next_in = (z_const unsigned char *)next;
+            strm.avail_in = (uint32_t)compr_lens[i];
+            strm.next_out = out;
+            strm.avail_out = (uint32_t)messages[i].len;
+            if (PREFIX(inflate)(&strm, Z_FINISH) != Z_STREAM_END ||
+                memcmp(out, corpus + messages[i].start, messages[i].len) != 0) {
+                fprintf(stderr, "makedict: inflate() failed\n");
+                exit(1);
+            }
+            next += compr_lens[i];
+        }
+        passes++;
+        elapsed = clock() - start;
+    } while (elapsed < EVAL_TIME);
+    bytes = total * passes;
+    *inflate_speed = (double)bytes / ((double)MAX(elapsed, 1) / CLOCKS_PER_SEC) / 1e6;
+    PREFIX(inflateEnd)(&strm);
+
+    free(out);
+    free(compr_lens);
+    free(compr);
+    return compr_len;
+}
+
+int main(int argc, char **argv) {
+    unsigned char *dict;
+    const char *output = NULL;
+    size_t message_size = 0, total = 0, plain_len, dict_compr_len, i;
+    double plain_deflate, plain_inflate, dict_deflate, dict_inflate;
+    uint32_t dict_size = 32768, dict_len;
+    int level = 6, files = 0;
+    FILE *f;
+
+    for (i = 1; i < (size_t)argc; i++) {
+        if ((strcmp(argv[i], "-s") == 0) && (i + 1 < (size_t)argc))
+            dict_size = (uint32_t)atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-m") == 0) && (i + 1 < (size_t)argc))
+            message_size = (size_t)atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-l") == 0) && (i + 1 < (size_t)argc))
+            level = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < (size_t)argc))
+            output = argv[++i];
+        else if (argv[i][0] == '-') {
+            show_help();
+            return 64;   /* EX_USAGE */
+        } else {
+            read_sample(argv[i], message_size);
+            files++;
+        }
+    }
+    if (files == 0 || dict_size == 0 || dict_size > 32768 || level < 0 || level > 9) {
+        show_help();
+        return 64;   /* EX_USAGE */
+    }
+
+    count_strings();
+    dict = (unsigned char *)xalloc(dict_size);
+    dict_len = build_dictionary(dict, dict_size);
+    if (output != NULL) {
+        f = fopen(output, "wb");
+        if (f == NULL || fwrite(dict, 1, dict_len, f) != dict_len || fclose(f) != 0) {
+            fprintf(stderr, "makedict: cannot write %s\n", output);
+            return 1;
+        }
+    }
+
+    for (i = 0; i < message_count; i++) {
+        if (evaluation(i))
+            total += messages[i].len;
+    }
+    plain_len = evaluate(dict, 0, level, &plain_deflate, &plain_inflate);
+    dict_compr_len = evaluate(dict, dict_len, level, &dict_deflate, &dict_inflate);
+    printf("%zu messages, %zu bytes, dictionary of %u bytes\n", message_count, corpus_len, dict_len);
+    printf("evaluated on %zu bytes%s at level %d\n", total,
+           message_count < 2 * EVAL_EVERY ? " of the training messages" : " of held out messages", level);
+    printf("without dictionary %10zu bytes  ratio %6.3f  deflate %8.1f MB/s  inflate %8.1f MB/s\n",
+           plain_len, (double)total / MAX(plain_len, 1), plain_deflate, plain_inflate);
+    printf("with dictionary    %10zu bytes  ratio %6.3f  deflate %8.1f MB/s  inflate %8.1f MB/s\n",
+           dict_compr_len, (double)total / MAX(dict_compr_len, 1), dict_deflate, dict_inflate);
+    printf("gain               %10.3fx       deflate %8.3fx       inflate %8.3fx\n",
+           (double)plain_len / MAX(dict_compr_len, 1), dict_deflate / plain_deflate, dict_inflate / plain_inflate);
+
+    free(dict);
+    free(seen);
+    free(counts);
+    free(messages);
+    free(corpus);
+    return 0;
+}
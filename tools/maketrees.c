@@ -32,6 +32,14 @@ static int base_length[LENGTH_CODES];
 static int base_dist[D_CODES];
 /* First normalized distance for each code (0 = distance of 1) */
 
+static sc_data static_lcode[STD_MAX_MATCH-STD_MIN_MATCH+1];
+/* Static length code and extra bits for each normalized match length */
+
+static sc_data static_dcode[DIST_CODE_LEN];
+/* Static distance code for each entry of dist_code, less the base distance
+ * shifted past the code, so that adding (dist << 5) yields code and extra bits.
+ */
+
 
 static void tr_static_init(void) {
     int n;        /* iterates over tree elements */
@@ -92,6 +100,20 @@ static void tr_static_init(void) {
         static_dtree[n].Len = 5;
         static_dtree[n].Code = bi_reverse((unsigned)n, 5);
     }
+
+    /* Combine the static codes with their extra bits */
+    for (n = 0; n < STD_MAX_MATCH-STD_MIN_MATCH+1; n++) {
+        code = length_code[n];
+        static_lcode[n].bits = static_ltree[code+LITERALS+1].Code;
+        if (extra_lbits[code] != 0)
+            static_lcode[n].bits |= (uint32_t)(n - base_length[code]) << static_ltree[code+LITERALS+1].Len;
+        static_lcode[n].len = static_ltree[code+LITERALS+1].Len + extra_lbits[code];
+    }
+    for (n = 0; n < DIST_CODE_LEN; n++) {
+        code = dist_code[n];
+        static_dcode[n].bits = static_dtree[code].Code - ((uint32_t)base_dist[code] << 5);
+        static_dcode[n].len = static_dtree[code].Len + extra_dbits[code];
+    }
 }
 
 #  define SEPARATOR(i, last, width) \
@@ -136,6 +158,16 @@ static void gen_trees_header() {
         printf("%5d%s", base_dist[i], SEPARATOR(i, D_CODES-1, 10));
     }
 
+    printf("Z_INTERNAL const sc_data static_lcode[STD_MAX_MATCH-STD_MIN_MATCH+1] = {\n");
+    for (i = 0; i < STD_MAX_MATCH-STD_MIN_MATCH+1; i++) {
+        printf("{%4u,%2u}%s", static_lcode[i].bits, static_lcode[i].len, SEPARATOR(i, STD_MAX_MATCH-STD_MIN_MATCH, 8));
+    }
+
+    printf("Z_INTERNAL const sc_data static_dcode[DIST_CODE_LEN] = {\n");
+    for (i = 0; i < DIST_CODE_LEN; i++) {
+        printf("{0x%08x,%2u}%s", static_dcode[i].bits, static_dcode[i].len, SEPARATOR(i, DIST_CODE_LEN-1, 6));
+    }
+
     printf("#endif /* TREES_TBL_H_ */\n");
 }
 
@@ -0,0 +1,487 @@
+/* transcode.c -- recompress a deflate stream reusing its parse
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * The source stream is decoded into its literals and matches instead of into
+ * bytes alone, and those are handed to deflateSequences(), which chooses the
+ * blocks and their Huffman codes again. That keeps the parse of a level at or
+ * above the target level for a fraction of the time of searching again. For a
+ * level above that of the source, the source parse is of no use, and the
+ * source is decompressed with inflate() and compressed again with deflate().
+ */
+
+#include "zbuild.h"
+#include "zutil.h"
+#include "deflate.h"
+#include "inftrees.h"
+
+#ifndef ZLIB_COMPAT
+
+#define TC_HISTORY   32768          /* largest distance of a deflate stream */
+#define TC_CHUNK     65536          /* bytes decoded between two calls of deflateSequences() */
+#define TC_SEQS      16384          /* sequences decoded between two calls */
+
+/* Decoder of the source, with the data decoded since the last TC_HISTORY
+ * bytes handed to deflate and the sequences that parse it */
+typedef struct {
+    const unsigned char *next;      /* next source byte */
+    const unsigned char *end;       /* end of the source */
+    uint64_t hold;                  /* bit buffer */
+    unsigned bits;                  /* bits in hold */
+
+    const code *lencode;            /* literal/length and distance codes of the block */
+    const code *distcode;
+    unsigned lenbits, distbits;
+    code codes[ENOUGH];             /* dynamic codes */
+    code fixed[512 + 32];           /* fixed codes */
+    uint16_t lens[320];
+    uint16_t work[288];
+
+    unsigned char out[TC_HISTORY + TC_CHUNK + STD_MAX_MATCH];
+    uint32_t have;                  /* bytes in out */
+    uint32_t fed;                   /* bytes of out handed to deflate */
+    zng_deflate_sequence seqs[TC_SEQS];
+    uint32_t nseqs;                 /* sequences in seqs */
+    uint32_t lits;                  /* literals since the last match */
+} transcode_state;
+
+/* Fill hold with whatever is left of the source, up to 56 bits */
+static inline void tc_refill(transcode_state *tc) {
+    while (tc->bits <= 56 && tc->next < tc->end) {
+        tc->hold |= (uint64_t)*tc->next++ << tc->bits;
+        tc->bits += 8;
+    }
+}
+
+/* Return n bits, 0 <= n <= 32, or -1 if the source ends first */
+static inline int64_t tc_bits(transcode_state *tc, unsigned n) {
+    uint32_t val;
+
+    if (tc->bits < n) {
+        tc_refill(tc);
+        if (tc->bits < n)
+            return -1;
+    }
+    val = (uint32_t)(tc->hold & ((UINT64_C(1) << n) - 1));
+    tc->hold >>= n;
+    tc->bits -= n;
+    return val;
+}
+
+/* Return the next entry of a decoding table, following a link to a second
+ * level table, or NULL if the source ends first */
+static inline const code *tc_decode(transcode_state *tc, const code *table, unsigned root) {
+    const code *here;
+    unsigned used;
+
+    if (tc->bits < 15)
+        tc_refill(tc);
+    here = &table[tc->hold & ((1u << root) - 1)];
+    used = 0;
+    if (here->op && (here->op & 0xf0) == 0) {
+        used = here->bits;
+        here = &table[here->val + ((tc->hold & ((1u << (here->bits + here->op)) - 1)) >> here->bits)];
+    }
+    if (used + here->bits > tc->bits)
+        return NULL;
+    tc->hold >>= used + here->bits;
+    tc->bits -= used + here->bits;
+    return here;
+}
+
+/* Build the fixed codes once for the stream */
+static void tc_fixed(transcode_state *tc) {
+    code *next = tc->fixed;
+    unsigned sym = 0;
+
+    while (sym < 144) tc->lens[sym++] = 8;
+    while (sym < 256) tc->lens[sym++] = 9;
+    while (sym < 280) tc->lens[sym++] = 7;
+    while (sym < 288) tc->lens[sym++] = 8;
+    tc->lenbits = 9;
+    zng_inflate_table(LENS, tc->lens, 288, &next, &tc->lenbits, tc->work);
+    for (sym = 0; sym < 32; sym++)
+        tc->lens[sym] = 5;
+    tc->distbits = 5;
+    zng_inflate_table(DISTS, tc->lens, 32, &next, &tc->distbits, tc->work);
+}
+
+/* Read the codes of a dynamic block, return Z_OK or Z_DATA_ERROR */
+static int tc_dynamic(transcode_state *tc) {
+    static const uint16_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    const code *here;
+    code *next;
+    int64_t nlen, ndist, ncode, val;
+    unsigned have, len, copy;
+
+    nlen = tc_bits(tc, 5);
+    ndist = tc_bits(tc, 5);
+    ncode = tc_bits(tc, 4);
+    if (ncode < 0)
+        return Z_DATA_ERROR;
+    nlen += 257;
+    ndist += 1;
+    ncode += 4;
+    if (nlen > 286 || ndist > 30)
+        return Z_DATA_ERROR;
+
+    for (have = 0; have < 19; have++) {
+        val = have < ncode ? tc_bits(tc, 3) : 0;
+        if (val < 0)
+            return Z_DATA_ERROR;
+        tc->lens[order[have]] = (uint16_t)val;
+    }
+    next = tc->codes;
+    tc->lencode = next;
+    tc->lenbits = 7;
+    if (zng_inflate_table(CODES, tc->lens, 19, &next, &tc->lenbits, tc->work))
+        return Z_DATA_ERROR;
+
+    for (have = 0; have < nlen + ndist;) {
+        if ((here = tc_decode(tc, tc->lencode, tc->lenbits)) == NULL)
+            return Z_DATA_ERROR;
+        if (here->val < 16) {
+            tc->lens[have++] = here->val;
+            continue;
+        }
+        if (here->val == 16) {
+            if (have == 0)
+                return Z_DATA_ERROR;
+            len = tc->lens[have - 1];
+            val = tc_bits(tc, 2);
+            copy = 3 + (unsigned)val;
+        } else if (here->val == 17) {
+            len = 0;
+            val = tc_bits(tc, 3);
+            copy = 3 + (unsigned)val;
+        } else {
+            len = 0;
+            val = tc_bits(tc, 7);
+            copy = 11 + (unsigned)val;
+        }
+        if (val < 0 || have + copy > nlen + ndist)
+            return Z_DATA_ERROR;
+        while (copy--)
+            tc->lens[have++] = (uint16_t)len;
+    }
+    if (tc->lens[256] == 0)
+        return Z_DATA_ERROR;
+
+    next = tc->codes;
+    tc->lencode = next;
+    tc->lenbits = 9;
+    if (zng_inflate_table(LENS, tc->lens, (unsigned)nlen, &next, &tc->lenbits, tc->work))
+        return Z_DATA_ERROR;
+    tc->distcode = next;
+    tc->distbits = 6;
+    if (zng_inflate_table(DISTS, tc->lens + nlen, (unsigned)ndist, &next, &tc->distbits, tc->work))
+        return Z_DATA_ERROR;
+    return Z_OK;
+}
+
+/* Hand what was decoded since the last call to deflateSequences(), and keep
+ * the last TC_HISTORY bytes for the matches to come. The sequences deflate did
+ * not get to yet go again with the next call. */
+static int tc_feed(transcode_state *tc, zng_stream *strm, int flush) {
+    size_t count, done = 0;
+    int ret;
+
+    if (tc->lits) {
+        tc->seqs[tc->nseqs].lit_len = tc->lits;
+        tc->seqs[tc->nseqs].match_len = 0;
+        tc->seqs[tc->nseqs].dist = 0;
+        tc->nseqs++;
+        tc->lits = 0;
+    }
+    strm->next_in = tc->out + tc->fed;
+    strm->avail_in = tc->have - tc->fed;
+    do {
+        count = tc->nseqs - done;
+        ret = zng_deflateSequences(strm, tc->seqs + done, &count, flush);
+        done += count;
+        if (ret == Z_STREAM_END)
+            break;
+        if (ret != Z_OK)
+            return ret;
+        if (strm->avail_out == 0)
+            return Z_BUF_ERROR;
+    } while (strm->avail_in != 0 || flush == Z_FINISH);
+    tc->nseqs -= (uint32_t)done;
+    memmove(tc->seqs, tc->seqs + done, tc->nseqs * sizeof(zng_deflate_sequence));
+    tc->fed = tc->have;
+
+    if (tc->have > TC_HISTORY) {
+        memmove(tc->out, tc->out + tc->have - TC_HISTORY, TC_HISTORY);
+        tc->have = tc->fed = TC_HISTORY;
+    }
+    return Z_OK;
+}
+
+/* Make room for len more bytes of output */
+static inline int tc_room(transcode_state *tc, zng_stream *strm, uint32_t len) {
+    if (tc->have + len > TC_HISTORY + TC_CHUNK || tc->nseqs == TC_SEQS - 1)
+        return tc_feed(tc, strm, Z_NO_FLUSH);
+    return Z_OK;
+}
+
+/* Decode the deflate data of the source into tc and compress it into strm.
+ * Matches up to window back are valid, but only those up to reach back can be
+ * sent as they are, the others are sent as literals. */
+static int tc_inflate(transcode_state *tc, zng_stream *strm, uint32_t window, uint32_t reach) {
+    const code *here;
+    int64_t last, type, val;
+    uint32_t len, dist, copy, i;
+    int ret;
+
+    tc_fixed(tc);
+    do {
+        last = tc_bits(tc, 1);
+        type = tc_bits(tc, 2);
+        if (type < 0)
+            return Z_DATA_ERROR;
+
+        if (type == 0) {
+            /* Stored block, its bytes are literals */
+            val = tc_bits(tc, tc->bits & 7);
+            len = (uint32_t)tc_bits(tc, 16);
+            val = tc_bits(tc, 16);
+            if (val < 0 || len != (~(uint32_t)val & 0xffff))
+                return Z_DATA_ERROR;
+            while (len) {
+                copy = MIN(len, TC_CHUNK);
+                if ((ret = tc_room(tc, strm, copy)) != Z_OK)
+                    return ret;
+                for (i = 0; i < copy; i++) {
+                    if ((val = tc_bits(tc, 8)) < 0)
+                        return Z_DATA_ERROR;
+                    tc->out[tc->have++] = (unsigned char)val;
+                }
+                tc->lits += copy;
+                len -= copy;
+            }
+            continue;
+        }
+
+        if (type == 1) {
+            tc->lencode = tc->fixed;
+            tc->lenbits = 9;
+            tc->distcode = tc->fixed + 512;
+            tc->distbits = 5;
+        } else if (type == 2) {
+            if (tc_dynamic(tc) != Z_OK)
+                return Z_DATA_ERROR;
+        } else {
+            return Z_DATA_ERROR;
+        }
+
+        for (;;) {
+            if ((ret = tc_room(tc, strm, STD_MAX_MATCH)) != Z_OK)
+                return ret;
+            if ((here = tc_decode(tc, tc->lencode, tc->lenbits)) == NULL)
+                return Z_DATA_ERROR;
+            if (here->op == 0) {
+                tc->out[tc->have++] = (unsigned char)here->val;
+                tc->lits++;
+                continue;
+            }
+            if (here->op & 32)
+                break;
+            if (here->op & 64)
+                return Z_DATA_ERROR;
+            if ((val = tc_bits(tc, here->op & 15)) < 0)
+                return Z_DATA_ERROR;
+            len = here->val + (uint32_t)val;
+
+            if ((here = tc_decode(tc, tc->distcode, tc->distbits)) == NULL || (here->op & 64))
+                return Z_DATA_ERROR;
+            if ((val = tc_bits(tc, here->op & 15)) < 0)
+                return Z_DATA_ERROR;
+            dist = here->val + (uint32_t)val;
+            if (dist > window || dist > tc->have)
+                return Z_DATA_ERROR;
+
+            for (i = 0; i < len; i++, tc->have++)
+                tc->out[tc->have] = tc->out[tc->have - dist];
+            if (dist > reach) {
+                tc->lits += len;
+                continue;
+            }
+            tc->seqs[tc->nseqs].lit_len = tc->lits;
+            tc->seqs[tc->nseqs].match_len = len;
+            tc->seqs[tc->nseqs].dist = dist;
+            tc->nseqs++;
+            tc->lits = 0;
+        }
+    } while (!last);
+    return Z_OK;
+}
+
+/* Decompress the deflate data of the source with inflate() into tc and
+ * compress it into strm with deflate() */
+static int tc_recompress(transcode_state *tc, zng_stream *strm, int window_bits) {
+    zng_stream inf;
+    int ret, flush;
+
+    memset(&inf, 0, sizeof(inf));
+    ret = zng_inflateInit2(&inf, -window_bits);
+    if (ret != Z_OK)
+        return ret;
+    inf.next_in = tc->next;
+    inf.avail_in = (uint32_t)MIN((size_t)(tc->end - tc->next), UINT32_MAX);
+    do {
+        inf.next_out = tc->out;
+        inf.avail_out = TC_CHUNK;
+        ret = zng_inflate(&inf, Z_NO_FLUSH);
+        if (ret != Z_OK && ret != Z_STREAM_END)
+            break;
+        flush = ret == Z_STREAM_END ? Z_FINISH : Z_NO_FLUSH;
+        strm->next_in = tc->out;
+        strm->avail_in = TC_CHUNK - inf.avail_out;
+        if (strm->avail_in == 0 && flush == Z_NO_FLUSH)
+            continue;
+        if (zng_deflate(strm, flush) != (flush == Z_FINISH ? Z_STREAM_END : Z_OK) || strm->avail_in != 0) {
+            zng_inflateEnd(&inf);
+            return Z_BUF_ERROR;
+        }
+    } while (ret == Z_OK);
+    tc->next = inf.next_in;
+    zng_inflateEnd(&inf);
+    /* A source that ends first leaves inflate() with nothing to do */
+    return ret == Z_STREAM_END ? Z_OK : ret == Z_MEM_ERROR ? ret : Z_DATA_ERROR;
+}
+
+/* ===========================================================================
+     Recompresses the deflate stream in source at the given level, see zlib-ng.h.
+*/
+int32_t Z_EXPORT zng_transcode(uint8_t *dest, size_t *destLen, const uint8_t *source, size_t *sourceLen,
+                               int32_t level, int32_t windowBits) {
+    zng_stream strm;
+    /* Highest level of each compression level of the zlib header, see deflate.c */
+    static const int flevel_max[4] = {1, 5, 6, 9};
+    zng_gz_header head;
+    transcode_state *tc;
+    const unsigned char *src = source, *end = source + *sourceLen;
+    int wrap, recompress, source_level = 6, ret;
+    uint32_t check;
+
+    if (windowBits >= 40 && windowBits <= 47)
+        wrap = *sourceLen >= 2 && src[0] == 31 && src[1] == 139 ? 2 : 1;
+    else if (windowBits >= 24 && windowBits <= 31)
+        wrap = 2;
+    else if (windowBits >= 8 && windowBits <= 15)
+        wrap = 1;
+    else if (windowBits >= -15 && windowBits <= -8)
+        wrap = 0;
+    else
+        return Z_STREAM_ERROR;
+    windowBits = wrap == 0 ? -windowBits : windowBits & 15;
+
+    /* Read the header of the source, the recompressed stream gets the same */
+    memset(&head, 0, sizeof(head));
+    if (wrap == 1) {
+        if (end - src < 2 || (src[0] & 0xf) != Z_DEFLATED || ((src[0] << 8) | src[1]) % 31 != 0 || (src[1] & 0x20))
+            return Z_DATA_ERROR;
+        if ((src[0] >> 4) + 8 > windowBits)
+            return Z_DATA_ERROR;
+        windowBits = (src[0] >> 4) + 8;
+        source_level = flevel_max[src[1] >> 6];
+        src += 2;
+    } else if (wrap == 2) {
+        unsigned flags;
+
+        if (end - src < 10 || src[0] != 31 || src[1] != 139 || src[2] != Z_DEFLATED || (src[3] & 0xe0))
+            return Z_DATA_ERROR;
+        flags = src[3];
+        head.text = flags & 1;
+        head.time = src[4] | (src[5] << 8) | (src[6] << 16) | ((unsigned long)src[7] << 24);
+        head.xflags = src[8];
+        source_level = src[8] == 2 ? 9 : src[8] == 4 ? 1 : 8;
+        head.os = src[9];
+        head.hcrc = (flags >> 1) & 1;
+        src += 10;
+        if (flags & 4) {
+            if (end - src < 2 || end - src - 2 < (src[0] | (src[1] << 8)))
+                return Z_DATA_ERROR;
+            head.extra_len = src[0] | (src[1] << 8);
+            head.extra = (unsigned char *)src + 2;
+            head.extra_max = head.extra_len;
+            src += 2 + head.extra_len;
+        }
+        if (flags & 8) {
+            head.name = (unsigned char *)src;
+            while (src < end && *src)
+                src++;
+            if (src++ == end)
+                return Z_DATA_ERROR;
+            head.name_max = (uint32_t)(src - head.name);
+        }
+        if (flags & 16) {
+            head.comment = (unsigned char *)src;
+            while (src < end && *src)
+                src++;
+            if (src++ == end)
+                return Z_DATA_ERROR;
+            head.comm_max = (uint32_t)(src - head.comment);
+        }
+        if (flags & 2) {
+            if (end - src < 2)
+                return Z_DATA_ERROR;
+            src += 2;
+        }
+    }
+    memset(&strm, 0, sizeof(strm));
+    ret = zng_deflateInit2(&strm, level, Z_DEFLATED, wrap == 0 ? -windowBits : windowBits + (wrap == 2 ? 16 : 0),
+                           DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK)
+        return ret;
+    /* Keep the parse of the source unless the level is above its own */
+    recompress = (level == Z_DEFAULT_COMPRESSION ? 6 : level) > source_level;
+    if (wrap == 2)
+        zng_deflateSetHeader(&strm, &head);
+
+    tc = (transcode_state *)strm.zalloc(strm.opaque, 1, sizeof(transcode_state));
+    if (tc == NULL) {
+        zng_deflateEnd(&strm);
+        return Z_MEM_ERROR;
+    }
+    memset(tc, 0, offsetof(transcode_state, codes));
+    tc->next = src;
+    tc->end = end;
+    tc->have = tc->fed = tc->nseqs = tc->lits = 0;
+
+    strm.next_out = dest;
+    strm.avail_out = (uint32_t)MIN(*destLen, UINT32_MAX);
+
+    if (recompress) {
+        ret = tc_recompress(tc, &strm, windowBits);
+    } else {
+        ret = tc_inflate(tc, &strm, 1u << windowBits, MAX_DIST((deflate_state *)strm.state));
+        if (ret == Z_OK)
+            ret = tc_feed(tc, &strm, Z_FINISH);
+    }
+
+    /* Check the trailer of the source against the data */
+    if (ret == Z_OK && wrap != 0) {
+        int64_t val;
+
+        tc_bits(tc, tc->bits & 7);
+        if (wrap == 1) {
+            val = tc_bits(tc, 32);
+            check = ZSWAP32((uint32_t)val);
+        } else {
+            val = tc_bits(tc, 32);
+            check = (uint32_t)val;
+            if (val >= 0)
+                val = (uint32_t)tc_bits(tc, 32) == (uint32_t)strm.total_in ? val : -1;
+        }
+        if (val < 0 || check != strm.adler)
+            ret = Z_DATA_ERROR;
+    }
+    /* Give back the bytes read ahead into hold */
+    *sourceLen = (size_t)(tc->next - source) - tc->bits / 8;
+    *destLen = strm.total_out;
+
+    strm.zfree(strm.opaque, tc);
+    zng_deflateEnd(&strm);
+    return ret;
+}
+#endif
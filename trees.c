@@ -66,14 +66,18 @@ static const static_tree_desc  static_bl_desc =
  */
 
 static void init_block       (deflate_state *s);
-static void pqdownheap       (deflate_state *s, ct_data *tree, int k);
-static void gen_bitlen       (deflate_state *s, tree_desc *desc);
-static void build_tree       (deflate_state *s, tree_desc *desc);
+static int  collect_codes    (tree_desc *desc, uint32_t *sorted);
+static void sort_codes       (deflate_state *s, uint32_t *sorted, int n);
+static void gen_lengths      (uint32_t *w, int n);
+static void build_tree       (deflate_state *s, tree_desc *desc, uint32_t *sorted, int codes);
 static void scan_tree        (deflate_state *s, ct_data *tree, int max_code);
 static void send_tree        (deflate_state *s, ct_data *tree, int max_code);
 static int  build_bl_tree    (deflate_state *s);
+static unsigned long estimate_block(deflate_state *s, int lcodes, int dcodes, unsigned long *static_len);
 static void send_all_trees   (deflate_state *s, int lcodes, int dcodes, int blcodes);
-static void compress_block   (deflate_state *s, const ct_data *ltree, const ct_data *dtree);
+static void compress_lits    (deflate_state *s, const ct_data *ltree, const unsigned char *lits, uint32_t len);
+static void compress_block   (deflate_state *s, const ct_data *ltree, const ct_data *dtree,
+                              const char *buf, uint32_t stored_len);
 static int  detect_data_type (deflate_state *s);
 static void bi_flush         (deflate_state *s);
 
@@ -118,158 +122,144 @@ static void init_block(deflate_state *s) {
     s->dyn_ltree[END_BLOCK].Freq = 1;
     s->opt_len = s->static_len = 0L;
     s->sym_next = s->matches = 0;
+    s->direct_lits = 0;
 }
 
-#define SMALLEST 1
-/* Index within the heap array of least frequent node in the Huffman tree */
-
+#define FREQ_SHIFT 9
+/* The sort keys of the codes hold the frequency above the code, which is less
+ * than 1 << FREQ_SHIFT, so that ties are broken by the code */
 
 /* ===========================================================================
- * Remove the smallest element from the heap and recreate the heap with
- * one less element. Updates heap and heap_len.
+ * Store the sort keys of the codes of non zero frequency of a tree in sorted,
+ * in order of code, set the length of the others to zero and return their
+ * number. The field max_code is set.
  */
-#define pqremove(s, tree, top) \
-{\
-    top = s->heap[SMALLEST]; \
-    s->heap[SMALLEST] = s->heap[s->heap_len--]; \
-    pqdownheap(s, tree, SMALLEST); \
-}
+static int collect_codes(tree_desc *desc, uint32_t *sorted) {
+    ct_data *tree = desc->dyn_tree;
+    int elems     = desc->stat_desc->elems;
+    int codes = 0;      /* number of codes with non zero frequency */
+    int max_code = -1;  /* largest code with non zero frequency */
+    int n;
 
-/* ===========================================================================
- * Compares to subtrees, using the tree depth as tie breaker when
- * the subtrees have equal frequency. This minimizes the worst case length.
- */
-#define smaller(tree, n, m, depth) \
-    (tree[n].Freq < tree[m].Freq || \
-    (tree[n].Freq == tree[m].Freq && depth[n] <= depth[m]))
+    /* Most codes of a small block are not in use, so keep all and only count
+     * those that are, rather than branch on each */
+    for (n = 0; n < elems; n++) {
+        sorted[codes] = ((uint32_t)tree[n].Freq << FREQ_SHIFT) | (uint32_t)n;
+        tree[n].Len = 0;
+        codes += (tree[n].Freq != 0);
+        max_code = tree[n].Freq != 0 ? n : max_code;
+    }
+    desc->max_code = max_code;
+    return codes;
+}
 
 /* ===========================================================================
- * Restore the heap property by moving down the tree starting at node k,
- * exchanging a node with the smallest of its two sons if necessary, stopping
- * when the heap property is re-established (each father smaller than its
- * two sons).
+ * Sort the n keys of sorted by increasing frequency. Few codes, as in the
+ * sparse trees of small blocks, are sorted by insertion, the others by a radix
+ * sort on each byte of the frequency.
  */
-static void pqdownheap(deflate_state *s, ct_data *tree, int k) {
-    /* tree: the tree to restore */
-    /* k: node to move down */
-    int v = s->heap[k];
-    int j = k << 1;  /* left son of k */
-    while (j <= s->heap_len) {
-        /* Set j to the smallest of the two sons: */
-        if (j < s->heap_len && smaller(tree, s->heap[j+1], s->heap[j], s->depth)) {
-            j++;
+static void sort_codes(deflate_state *s, uint32_t *sorted, int n) {
+    uint32_t *tmp = s->weight;  /* not in use yet */
+    uint32_t count[256];
+    uint32_t key, sum, c;
+    unsigned int shift;
+    int i, j;
+
+    if (n <= 32) {
+        for (i = 1; i < n; i++) {
+            key = sorted[i];
+            for (j = i; j > 0 && sorted[j-1] > key; j--)
+                sorted[j] = sorted[j-1];
+            sorted[j] = key;
         }
-        /* Exit if v is smaller than both sons */
-        if (smaller(tree, v, s->heap[j], s->depth))
-            break;
-
-        /* Exchange v with the smallest son */
-        s->heap[k] = s->heap[j];
-        k = j;
+        return;
+    }
 
-        /* And continue down the tree, setting j to the left son of k */
-        j <<= 1;
+    for (shift = FREQ_SHIFT; shift < FREQ_SHIFT + 16; shift += 8) {
+        memset(count, 0, sizeof(count));
+        for (i = 0; i < n; i++)
+            count[(sorted[i] >> shift) & 0xff]++;
+        /* Skip the byte if it is the same for all codes */
+        if (count[(sorted[0] >> shift) & 0xff] == (uint32_t)n)
+            continue;
+        for (i = 0, sum = 0; i < 256; i++) {
+            c = count[i];
+            count[i] = sum;
+            sum += c;
+        }
+        for (i = 0; i < n; i++)
+            tmp[count[(sorted[i] >> shift) & 0xff]++] = sorted[i];
+        memcpy(sorted, tmp, n * sizeof(uint32_t));
     }
-    s->heap[k] = v;
 }
 
 /* ===========================================================================
- * Compute the optimal bit lengths for a tree and update the total bit length
- * for the current block.
- * IN assertion: the fields freq and dad are set, heap[heap_max] and
- *    above are the tree nodes sorted by increasing frequency.
- * OUT assertions: the field len is set to the optimal bit length, the
- *     array bl_count contains the frequencies for each bit length.
- *     The length opt_len is updated; static_len is also updated if stree is
- *     not null.
+ * Replace the n weights of w, sorted by increasing weight, by the bit lengths
+ * of an optimal prefix code for them, without building the tree (Moffat and
+ * Katajainen, "In-Place Calculation of Minimum-Redundancy Codes", 1995).
+ * A leaf is combined before an internal node of equal weight, which keeps the
+ * longest code as short as possible, as the depth tie breaker of the heap did.
+ * IN assertion: n >= 2
+ * OUT assertion: the lengths are not increasing, but may exceed MAX_BITS.
  */
-static void gen_bitlen(deflate_state *s, tree_desc *desc) {
-    /* desc: the tree descriptor */
-    ct_data *tree           = desc->dyn_tree;
-    int max_code            = desc->max_code;
-    const ct_data *stree    = desc->stat_desc->static_tree;
-    const int *extra        = desc->stat_desc->extra_bits;
-    int base                = desc->stat_desc->extra_base;
-    unsigned int max_length = desc->stat_desc->max_length;
-    int h;              /* heap index */
-    int n, m;           /* iterate over the tree elements */
-    unsigned int bits;  /* bit length */
-    int xbits;          /* extra bits */
-    uint16_t f;         /* frequency */
-    int overflow = 0;   /* number of elements with bit length too large */
-
-    for (bits = 0; bits <= MAX_BITS; bits++)
-        s->bl_count[bits] = 0;
-
-    /* In a first pass, compute the optimal bit lengths (which may
-     * overflow in the case of the bit length tree).
+static void gen_lengths(uint32_t *w, int n) {
+    int root;           /* next internal node to combine */
+    int leaf;           /* next leaf to combine */
+    int next;           /* next internal node to create */
+    int avbl, used;     /* nodes available and used at the current depth */
+    uint32_t depth;
+
+    /* In a first pass, from left to right, combine the two lightest of the
+     * leaves and internal nodes, keeping the weight of each internal node
+     * until it is combined and then the index of its parent.
      */
-    tree[s->heap[s->heap_max]].Len = 0; /* root of the heap */
-
-    for (h = s->heap_max + 1; h < HEAP_SIZE; h++) {
-        n = s->heap[h];
-        bits = tree[tree[n].Dad].Len + 1u;
-        if (bits > max_length){
-            bits = max_length;
-            overflow++;
+    w[0] += w[1];
+    root = 0;
+    leaf = 2;
+    for (next = 1; next < n - 1; next++) {
+        if (leaf >= n || w[root] < w[leaf]) {
+            w[next] = w[root];
+            w[root++] = (uint32_t)next;
+        } else {
+            w[next] = w[leaf++];
+        }
+        if (leaf >= n || (root < next && w[root] < w[leaf])) {
+            w[next] += w[root];
+            w[root++] = (uint32_t)next;
+        } else {
+            w[next] += w[leaf++];
         }
-        tree[n].Len = (uint16_t)bits;
-        /* We overwrite tree[n].Dad which is no longer needed */
-
-        if (n > max_code) /* not a leaf node */
-            continue;
-
-        s->bl_count[bits]++;
-        xbits = 0;
-        if (n >= base)
-            xbits = extra[n-base];
-        f = tree[n].Freq;
-        s->opt_len += (unsigned long)f * (unsigned int)(bits + xbits);
-        if (stree)
-            s->static_len += (unsigned long)f * (unsigned int)(stree[n].Len + xbits);
     }
-    if (overflow == 0)
-        return;
 
-    Tracev((stderr, "\nbit length overflow\n"));
-    /* This happens for example on obj2 and pic of the Calgary corpus */
-
-    /* Find the first bit length which could increase: */
-    do {
-        bits = max_length - 1;
-        while (s->bl_count[bits] == 0)
-            bits--;
-        s->bl_count[bits]--;       /* move one leaf down the tree */
-        s->bl_count[bits+1] += 2u; /* move one overflow item as its brother */
-        s->bl_count[max_length]--;
-        /* The brother of the overflow item also moves one step up,
-         * but this does not affect bl_count[max_length]
-         */
-        overflow -= 2;
-    } while (overflow > 0);
+    /* In a second pass, from right to left, turn the parent indexes into the
+     * depths of the internal nodes.
+     */
+    w[n-2] = 0;
+    for (next = n - 3; next >= 0; next--)
+        w[next] = w[w[next]] + 1;
 
-    /* Now recompute all bit lengths, scanning in increasing frequency.
-     * h is still equal to HEAP_SIZE. (It is simpler to reconstruct all
-     * lengths instead of fixing only the wrong ones. This idea is taken
-     * from 'ar' written by Haruhiko Okumura.)
+    /* In a third pass, from right to left, fill the leaves of each depth with
+     * the lengths.
      */
-    for (bits = max_length; bits != 0; bits--) {
-        n = s->bl_count[bits];
-        while (n != 0) {
-            m = s->heap[--h];
-            if (m > max_code)
-                continue;
-            if (tree[m].Len != bits) {
-                Tracev((stderr, "code %d bits %d->%u\n", m, tree[m].Len, bits));
-                s->opt_len += (unsigned long)(bits * tree[m].Freq);
-                s->opt_len -= (unsigned long)(tree[m].Len * tree[m].Freq);
-                tree[m].Len = (uint16_t)bits;
-            }
-            n--;
+    avbl = 1;
+    used = 0;
+    depth = 0;
+    root = n - 2;
+    next = n - 1;
+    while (avbl > 0) {
+        while (root >= 0 && w[root] == depth) {
+            used++;
+            root--;
         }
+        while (avbl > used) {
+            w[next--] = depth;
+            avbl--;
+        }
+        avbl = 2 * used;
+        depth++;
+        used = 0;
     }
 }
-
 /* ===========================================================================
  * Generate the codes for a given tree and bit counts (which need not be
  * optimal).
@@ -315,45 +305,38 @@ Z_INTERNAL void gen_codes(ct_data *tree, int max_code, uint16_t *bl_count) {
 /* ===========================================================================
  * Construct one Huffman tree and assigns the code bit strings and lengths.
  * Update the total bit length for the current block.
- * IN assertion: the field freq is set for all tree elements.
+ * IN assertion: the field freq is set for all tree elements, and sorted holds
+ *     the codes collected by collect_codes().
  * OUT assertions: the fields len and code are set to the optimal bit length
  *     and corresponding code. The length opt_len is updated; static_len is
  *     also updated if stree is not null. The field max_code is set.
  */
-static void build_tree(deflate_state *s, tree_desc *desc) {
+static void build_tree(deflate_state *s, tree_desc *desc, uint32_t *sorted, int codes) {
     /* desc: the tree descriptor */
-    ct_data *tree         = desc->dyn_tree;
-    const ct_data *stree  = desc->stat_desc->static_tree;
-    int elems             = desc->stat_desc->elems;
-    int n, m;          /* iterate over heap elements */
-    int max_code = -1; /* largest code with non zero frequency */
-    int node;          /* new node being created */
-
-    /* Construct the initial heap, with least frequent element in
-     * heap[SMALLEST]. The sons of heap[n] are heap[2*n] and heap[2*n+1].
-     * heap[0] is not used.
-     */
-    s->heap_len = 0;
-    s->heap_max = HEAP_SIZE;
-
-    for (n = 0; n < elems; n++) {
-        if (tree[n].Freq != 0) {
-            s->heap[++(s->heap_len)] = max_code = n;
-            s->depth[n] = 0;
-        } else {
-            tree[n].Len = 0;
-        }
-    }
+    /* sorted, codes: the sort keys of the codes of non zero frequency */
+    ct_data *tree           = desc->dyn_tree;
+    const ct_data *stree    = desc->stat_desc->static_tree;
+    const int *extra        = desc->stat_desc->extra_bits;
+    int base                = desc->stat_desc->extra_base;
+    unsigned int max_length = desc->stat_desc->max_length;
+    uint32_t *weight        = s->weight;
+    int max_code            = desc->max_code;
+    int i, n, m;        /* iterate over the codes */
+    int node;           /* forced code */
+    unsigned int bits;  /* bit length */
+    int xbits;          /* extra bits */
+    uint16_t f;         /* frequency */
+    uint32_t overflow = 0;  /* number of codes with bit length too large */
 
     /* The pkzip format requires that at least one distance code exists,
      * and that at least one bit should be sent even if there is only one
      * possible code. So to avoid special checks later on we force at least
      * two codes of non zero frequency.
      */
-    while (s->heap_len < 2) {
-        node = s->heap[++(s->heap_len)] = (max_code < 2 ? ++max_code : 0);
+    while (codes < 2) {
+        node = (max_code < 2 ? ++max_code : 0);
         tree[node].Freq = 1;
-        s->depth[node] = 0;
+        sorted[codes++] = (1u << FREQ_SHIFT) | (uint32_t)node;
         s->opt_len--;
         if (stree)
             s->static_len -= stree[node].Len;
@@ -361,45 +344,72 @@ static void build_tree(deflate_state *s, tree_desc *desc) {
     }
     desc->max_code = max_code;
 
-    /* The elements heap[heap_len/2+1 .. heap_len] are leaves of the tree,
-     * establish sub-heaps of increasing lengths:
+    /* Compute the optimal bit lengths of the codes sorted by frequency, which
+     * may overflow in the case of the bit length tree.
      */
-    for (n = s->heap_len/2; n >= 1; n--)
-        pqdownheap(s, tree, n);
+    sort_codes(s, sorted, codes);
+    for (i = 0; i < codes; i++)
+        weight[i] = sorted[i] >> FREQ_SHIFT;
+    gen_lengths(weight, codes);
 
-    /* Construct the Huffman tree by repeatedly combining the least two
-     * frequent nodes.
-     */
-    node = elems;              /* next internal node of the tree */
-    do {
-        pqremove(s, tree, n);  /* n = node of least frequency */
-        m = s->heap[SMALLEST]; /* m = node of next least frequency */
-
-        s->heap[--(s->heap_max)] = n; /* keep the nodes sorted by frequency */
-        s->heap[--(s->heap_max)] = m;
-
-        /* Create a new node father of n and m */
-        tree[node].Freq = tree[n].Freq + tree[m].Freq;
-        s->depth[node] = (unsigned char)((s->depth[n] >= s->depth[m] ?
-                                          s->depth[n] : s->depth[m]) + 1);
-        tree[n].Dad = tree[m].Dad = (uint16_t)node;
-#ifdef DUMP_BL_TREE
-        if (tree == s->bl_tree) {
-            fprintf(stderr, "\nnode %d(%d), sons %d(%d) %d(%d)",
-                    node, tree[node].Freq, n, tree[n].Freq, m, tree[m].Freq);
+    for (bits = 0; bits <= MAX_BITS; bits++)
+        s->bl_count[bits] = 0;
+    for (i = 0; i < codes; i++) {
+        bits = weight[i];
+        if (bits > max_length) {
+            bits = max_length;
+            overflow++;
         }
-#endif
-        /* and insert the new node in the heap */
-        s->heap[SMALLEST] = node++;
-        pqdownheap(s, tree, SMALLEST);
-    } while (s->heap_len >= 2);
+        s->bl_count[bits]++;
+    }
 
-    s->heap[--(s->heap_max)] = s->heap[SMALLEST];
+    if (overflow != 0) {
+        Tracev((stderr, "\nbit length overflow\n"));
+        /* This happens for example on obj2 and pic of the Calgary corpus */
 
-    /* At this point, the fields freq and dad are set. We can now
-     * generate the bit lengths.
-     */
-    gen_bitlen(s, (tree_desc *)desc);
+        /* Clamping the lengths made the code oversubscribed, by as many codes
+         * of max_length as follows from the Kraft sum.
+         */
+        overflow = 0;
+        for (bits = 1; bits <= max_length; bits++)
+            overflow += (uint32_t)s->bl_count[bits] << (max_length - bits);
+        overflow -= 1u << max_length;
+
+        /* Find the first bit length which could increase: */
+        while (overflow > 0) {
+            bits = max_length - 1;
+            while (s->bl_count[bits] == 0)
+                bits--;
+            s->bl_count[bits]--;       /* move one leaf down the tree */
+            s->bl_count[bits+1] += 2u; /* move one overflow item as its brother */
+            s->bl_count[max_length]--;
+            overflow--;
+        }
+
+        /* Now recompute all bit lengths, in increasing frequency. (It is
+         * simpler to reconstruct all lengths instead of fixing only the wrong
+         * ones. This idea is taken from 'ar' written by Haruhiko Okumura.)
+         */
+        i = 0;
+        for (bits = max_length; bits != 0; bits--) {
+            for (m = s->bl_count[bits]; m != 0; m--)
+                weight[i++] = bits;
+        }
+    }
+
+    /* Set the bit lengths and update the total bit length of the block */
+    for (i = 0; i < codes; i++) {
+        n = (int)(sorted[i] & ((1u << FREQ_SHIFT) - 1));
+        bits = weight[i];
+        tree[n].Len = (uint16_t)bits;
+        xbits = 0;
+        if (n >= base)
+            xbits = extra[n-base];
+        f = tree[n].Freq;
+        s->opt_len += (unsigned long)f * (unsigned int)(bits + xbits);
+        if (stree)
+            s->static_len += (unsigned long)f * (unsigned int)(stree[n].Len + xbits);
+    }
 
     /* The field len is now set, we can generate the bit codes */
     gen_codes((ct_data *)tree, max_code, s->bl_count);
@@ -525,13 +535,15 @@ static void send_tree(deflate_state *s, ct_data *tree, int max_code) {
  */
 static int build_bl_tree(deflate_state *s) {
     int max_blindex;  /* index of last bit length code of non zero freq */
+    int codes;        /* number of bit length codes of non zero freq */
 
     /* Determine the bit length frequencies for literal and distance trees */
     scan_tree(s, (ct_data *)s->dyn_ltree, s->l_desc.max_code);
     scan_tree(s, (ct_data *)s->dyn_dtree, s->d_desc.max_code);
 
     /* Build the bit length tree: */
-    build_tree(s, (tree_desc *)(&(s->bl_desc)));
+    codes = collect_codes((tree_desc *)(&(s->bl_desc)), s->sorted);
+    build_tree(s, (tree_desc *)(&(s->bl_desc)), s->sorted, codes);
     /* opt_len now includes the length of the tree representations, except
      * the lengths of the bit lengths codes and the 5+5+4 bits for the counts.
      */
@@ -626,6 +638,94 @@ void Z_INTERNAL zng_tr_align(deflate_state *s) {
     bi_flush(s);
 }
 
+/* ===========================================================================
+ * 256 * log2(x) for x > 0, at most 0.014 bit below the exact value.
+ */
+static uint32_t log2_fixed(uint32_t x) {
+    /* 256 * log2(1 + i / 128), rounded */
+    static const uint8_t log2_tab[128] = {
+          0,   3,   6,   9,  11,  14,  17,  20,  22,  25,  28,  30,  33,  36,  38,  41,
+         44,  46,  49,  51,  54,  56,  59,  61,  63,  66,  68,  71,  73,  75,  78,  80,
+         82,  85,  87,  89,  92,  94,  96,  98, 100, 103, 105, 107, 109, 111, 113, 116,
+        118, 120, 122, 124, 126, 128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148,
+        150, 152, 154, 155, 157, 159, 161, 163, 165, 167, 169, 170, 172, 174, 176, 178,
+        179, 181, 183, 185, 186, 188, 190, 192, 193, 195, 197, 198, 200, 202, 203, 205,
+        207, 208, 210, 212, 213, 215, 216, 218, 220, 221, 223, 224, 226, 228, 229, 231,
+        232, 234, 235, 237, 238, 240, 241, 243, 244, 246, 247, 249, 250, 252, 253, 255
+    };
+    uint32_t log, shift;
+
+    /* Find the leading bit without branches, the frequencies come in no order */
+    shift = (uint32_t)(x >= 1u << 16) << 4;
+    log = shift;
+    shift = (uint32_t)((x >> log) >= 1u << 8) << 3;
+    log += shift;
+    shift = (uint32_t)((x >> log) >= 1u << 4) << 2;
+    log += shift;
+    shift = (uint32_t)((x >> log) >= 1u << 2) << 1;
+    log += shift;
+    log += (uint32_t)((x >> log) >= 1u << 1);
+
+    /* and look the next 7 bits up */
+    return (log << 8) + log2_tab[(((uint64_t)x << 7) >> log) - 128];
+}
+
+/* ===========================================================================
+ * Compute static_len from the frequencies of the current block and estimate
+ * the bit length of the block with dynamic trees, without building the trees.
+ * No prefix code sends the symbols in fewer bits than their entropy, and the
+ * trees take the 14 bits of the counts, at least four bit length codes of
+ * 3 bits and then about DYN_BITS_PER_CODE for the length of each code in use.
+ * That is what the lengths of the codes of a typical block cost, but runs of
+ * equal lengths cost as little as half a bit each, so this is an estimate and
+ * not a bound: it may exceed opt_len by up to 3.5 bits per code in use, and
+ * the block is then sent with the static trees or stored where the dynamic
+ * trees would have won by that little.
+ * IN assertion: s->sorted holds the lcodes literal/length codes and, from
+ *     L_CODES on, the dcodes distance codes collected by collect_codes().
+ */
+#define DYN_BITS_PER_CODE 4
+
+static unsigned long estimate_block(deflate_state *s, int lcodes, int dcodes, unsigned long *static_len) {
+    const uint32_t *lkeys = s->sorted, *dkeys = s->sorted + L_CODES;
+    uint64_t lit_log = 0, dist_log = 0;   /* sums of freq * 256 * log2(freq) */
+    uint32_t lits = 0, dists = 0;         /* number of symbols */
+    unsigned long xbits = 0;              /* extra bits, the same for both */
+    unsigned long stat = 0;
+    uint64_t entropy;
+    uint32_t f, code;
+    int i;
+
+    for (i = 0; i < lcodes; i++) {
+        f = lkeys[i] >> FREQ_SHIFT;
+        code = lkeys[i] & ((1u << FREQ_SHIFT) - 1);
+        lits += f;
+        lit_log += (uint64_t)f * log2_fixed(f);
+        stat += (unsigned long)f * static_ltree[code].Len;
+    }
+    for (i = 0; i < LENGTH_CODES; i++)
+        xbits += (unsigned long)s->dyn_ltree[LITERALS+1+i].Freq * (unsigned int)extra_lbits[i];
+    for (i = 0; i < dcodes; i++) {
+        f = dkeys[i] >> FREQ_SHIFT;
+        code = dkeys[i] & ((1u << FREQ_SHIFT) - 1);
+        dists += f;
+        dist_log += (uint64_t)f * log2_fixed(f);
+        stat += (unsigned long)f * static_dtree[code].Len;
+        xbits += (unsigned long)f * (unsigned int)extra_dbits[code];
+    }
+    *static_len = stat + xbits;
+
+    /* The entropy in 1/256 bit is count * log2(count) - sum of freq * log2(freq).
+     * The rounding of log2_fixed() costs less than 8/256 bit per symbol.
+     */
+    entropy = (uint64_t)lits * log2_fixed(lits) - lit_log;
+    if (dists != 0)
+        entropy += (uint64_t)dists * log2_fixed(dists) - dist_log;
+    entropy -= MIN(entropy, (uint64_t)(lits + dists) * 8);
+
+    return (unsigned long)(entropy >> 8) + xbits + 5+5+4 + 4*3 + DYN_BITS_PER_CODE * (unsigned long)(lcodes + dcodes);
+}
+
 /* ===========================================================================
  * Determine the best encoding for the current block: dynamic trees, static
  * trees or store, and write out the encoded block.
@@ -635,10 +735,25 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
     /* stored_len: length of input block */
     /* last: one if this is the last block for a file */
     unsigned long opt_lenb, static_lenb; /* opt_len and static_len in bytes */
+    unsigned long dyn_lenb;     /* estimate of opt_lenb */
+    unsigned long static_len;   /* static_len before the trees are built */
+    int lcodes, dcodes;         /* number of literal/length and distance codes in use */
     int max_blindex = 0;  /* index of last bit length code of non zero freq */
 
+    /* Tell deflate_adaptive() what the block holds, before build_tree() adds
+     * distance codes to make a complete tree. Distance codes 0 to 5 are for
+     * distances 1 to 8.
+     */
+    if (s->strategy == Z_ADAPTIVE) {
+        s->blk_in = stored_len;
+        s->blk_matches = s->matches;
+        s->blk_lits = s->sym_next / SYM_SIZE - s->matches + s->direct_lits;
+        s->blk_near = s->dyn_dtree[0].Freq + s->dyn_dtree[1].Freq + s->dyn_dtree[2].Freq +
+                      s->dyn_dtree[3].Freq + s->dyn_dtree[4].Freq + s->dyn_dtree[5].Freq;
+    }
+
     /* Build the Huffman trees unless a stored block is forced */
-    if (UNLIKELY(s->sym_next == 0)) {
+    if (UNLIKELY(s->sym_next == 0 && s->direct_lits == 0)) {
         /* Emit an empty static tree block with no codes */
         opt_lenb = static_lenb = 0;
         s->static_len = 7;
@@ -647,36 +762,57 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
         if (s->strm->data_type == Z_UNKNOWN)
             s->strm->data_type = detect_data_type(s);
 
-        /* Construct the literal and distance trees */
-        build_tree(s, (tree_desc *)(&(s->l_desc)));
-        Tracev((stderr, "\nlit data: dyn %lu, stat %lu", s->opt_len, s->static_len));
-
-        build_tree(s, (tree_desc *)(&(s->d_desc)));
-        Tracev((stderr, "\ndist data: dyn %lu, stat %lu", s->opt_len, s->static_len));
-        /* At this point, opt_len and static_len are the total bit lengths of
-         * the compressed block data, excluding the tree representations.
+        /* Skip building the trees if the dynamic trees would not be smaller
+         * than the static trees or a stored block, as for short messages and
+         * data that does not compress. Z_FIXED only needs them when a stored
+         * block may be smaller than the static trees, since it stores a block
+         * only if the dynamic trees lose to the stored block too.
          */
-
-        /* Build the bit length tree for the above two trees, and get the index
-         * in bl_order of the last bit length code to send.
-         */
-        max_blindex = build_bl_tree(s);
-
-        /* Determine the best encoding. Compute the block lengths in bytes. */
-        opt_lenb = (s->opt_len+3+7) >> 3;
-        static_lenb = (s->static_len+3+7) >> 3;
-
-        Tracev((stderr, "\nopt %lu(%lu) stat %lu(%lu) stored %u lit %u ",
-                opt_lenb, s->opt_len, static_lenb, s->static_len, stored_len,
-                s->sym_next / 3));
-
-        if (static_lenb <= opt_lenb)
+        lcodes = collect_codes((tree_desc *)(&(s->l_desc)), s->sorted);
+        dcodes = collect_codes((tree_desc *)(&(s->d_desc)), s->sorted + L_CODES);
+        dyn_lenb = (estimate_block(s, lcodes, dcodes, &static_len)+3+7) >> 3;
+        static_lenb = (static_len+3+7) >> 3;
+
+        if (s->strategy == Z_FIXED ? static_lenb < stored_len+4 || buf == NULL
+                                   : dyn_lenb >= static_lenb || (dyn_lenb >= stored_len+4 && buf != NULL)) {
+            s->static_len = static_len;
             opt_lenb = static_lenb;
+            Tracev((stderr, "\nno dyn trees: dyn >= %lu stat %lu(%lu) stored %u ",
+                    dyn_lenb, static_lenb, s->static_len, stored_len));
+        } else {
+            /* Construct the literal and distance trees */
+            build_tree(s, (tree_desc *)(&(s->l_desc)), s->sorted, lcodes);
+            Tracev((stderr, "\nlit data: dyn %lu, stat %lu", s->opt_len, s->static_len));
+
+            build_tree(s, (tree_desc *)(&(s->d_desc)), s->sorted + L_CODES, dcodes);
+            Tracev((stderr, "\ndist data: dyn %lu, stat %lu", s->opt_len, s->static_len));
+            /* At this point, opt_len and static_len are the total bit lengths of
+             * the compressed block data, excluding the tree representations.
+             */
+
+            /* Build the bit length tree for the above two trees, and get the index
+             * in bl_order of the last bit length code to send.
+             */
+            max_blindex = build_bl_tree(s);
+            Assert(s->static_len == static_len, "bad static_len estimate");
+
+            /* Determine the best encoding. Compute the block lengths in bytes. */
+            opt_lenb = (s->opt_len+3+7) >> 3;
+
+            Tracev((stderr, "\nopt %lu(%lu) stat %lu(%lu) stored %u lit %u ",
+                    opt_lenb, s->opt_len, static_lenb, s->static_len, stored_len,
+                    s->sym_next / SYM_SIZE + s->direct_lits));
+
+            if (static_lenb <= opt_lenb)
+                opt_lenb = static_lenb;
+        }
 
     } else {
         Assert(buf != NULL, "lost buf");
         opt_lenb = static_lenb = stored_len + 5; /* force a stored block */
     }
+    if (s->strategy == Z_ADAPTIVE)
+        s->blk_out = (unsigned int)MIN(opt_lenb, stored_len + 4);
 
     if (stored_len+4 <= opt_lenb && buf != NULL) {
         /* 4: two words for the lengths
@@ -690,12 +826,12 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
 
     } else if (s->strategy == Z_FIXED || static_lenb == opt_lenb) {
         zng_tr_emit_tree(s, STATIC_TREES, last);
-        compress_block(s, (const ct_data *)static_ltree, (const ct_data *)static_dtree);
+        compress_block(s, (const ct_data *)static_ltree, (const ct_data *)static_dtree, buf, stored_len);
         cmpr_bits_add(s, s->static_len);
     } else {
         zng_tr_emit_tree(s, DYN_TREES, last);
         send_all_trees(s, s->l_desc.max_code+1, s->d_desc.max_code+1, max_blindex+1);
-        compress_block(s, (const ct_data *)s->dyn_ltree, (const ct_data *)s->dyn_dtree);
+        compress_block(s, (const ct_data *)s->dyn_ltree, (const ct_data *)s->dyn_dtree, buf, stored_len);
         cmpr_bits_add(s, s->opt_len);
     }
     Assert(s->compressed_len == s->bits_sent, "bad compressed size");
@@ -710,17 +846,81 @@ void Z_INTERNAL zng_tr_flush_block(deflate_state *s, char *buf, uint32_t stored_
     Tracev((stderr, "\ncomprlen %lu(%lu) ", s->compressed_len>>3, s->compressed_len-7*last));
 }
 
+/* ===========================================================================
+ * Send literals taken straight from the window or from l_buf. Up to four
+ * codes of at most MAX_BITS are packed together so that the bit buffer is
+ * updated once per four bytes rather than once per byte.
+ */
+static void compress_lits(deflate_state *s, const ct_data *ltree, const unsigned char *lits, uint32_t len) {
+    uint32_t bi_valid = s->bi_valid;
+    uint64_t bi_buf = s->bi_buf;
+    uint64_t codes;
+    uint32_t codes_len;
+
+    while (len >= 4) {
+        codes = ltree[lits[0]].Code;
+        codes_len = ltree[lits[0]].Len;
+        codes |= (uint64_t)ltree[lits[1]].Code << codes_len;
+        codes_len += ltree[lits[1]].Len;
+        codes |= (uint64_t)ltree[lits[2]].Code << codes_len;
+        codes_len += ltree[lits[2]].Len;
+        codes |= (uint64_t)ltree[lits[3]].Code << codes_len;
+        codes_len += ltree[lits[3]].Len;
+        send_bits(s, codes, codes_len, bi_buf, bi_valid);
+        lits += 4;
+        len -= 4;
+    }
+    while (len--) {
+        send_code(s, *lits, ltree, bi_buf, bi_valid);
+        lits++;
+    }
+
+    s->bi_valid = bi_valid;
+    s->bi_buf = bi_buf;
+}
+
 /* ===========================================================================
  * Send the block data compressed using the given Huffman trees
  */
-static void compress_block(deflate_state *s, const ct_data *ltree, const ct_data *dtree) {
+static void compress_block(deflate_state *s, const ct_data *ltree, const ct_data *dtree,
+                           const char *buf, uint32_t stored_len) {
     /* ltree: literal tree */
     /* dtree: distance tree */
+    /* buf, stored_len: input block, the tail of which holds the direct literals */
     unsigned dist;      /* distance of matched string */
     int lc;             /* match length or unmatched char (if dist == 0) */
     unsigned sx = 0;    /* running index in sym_buf */
 
     if (s->sym_next != 0) {
+#ifdef LIT_MEM
+        unsigned run;       /* end of a run of literals */
+        uint64_t dists;
+
+        do {
+            dist = s->d_buf[sx];
+            if (dist == 0) {
+                /* Find the end of the run of literals, four distances at a time,
+                 * and send it from l_buf as is */
+                run = sx + 1;
+                while (run + 4 <= s->sym_next) {
+                    memcpy(&dists, s->d_buf + run, sizeof(dists));
+                    if (dists != 0)
+                        break;
+                    run += 4;
+                }
+                while (run < s->sym_next && s->d_buf[run] == 0)
+                    run++;
+                compress_lits(s, ltree, s->l_buf + sx, run - sx);
+                sx = run;
+            } else {
+                lc = s->l_buf[sx++];
+                zng_emit_dist(s, ltree, dtree, lc, dist);
+            } /* literal or match pair ? */
+
+            /* Check that the overlay between pending_buf and d_buf is ok: */
+            Assert(s->pending < 2 * (s->lit_bufsize + sx), "pending_buf overflow");
+        } while (sx < s->sym_next);
+#else
         do {
             dist = s->sym_buf[sx++] & 0xff;
             dist += (unsigned)(s->sym_buf[sx++] & 0xff) << 8;
@@ -734,6 +934,12 @@ static void compress_block(deflate_state *s, const ct_data *ltree, const ct_data
             /* Check that the overlay between pending_buf and sym_buf is ok: */
             Assert(s->pending < s->lit_bufsize + sx, "pending_buf overflow");
         } while (sx < s->sym_next);
+#endif
+    }
+
+    if (s->direct_lits != 0) {
+        Assert(buf != NULL && s->direct_lits <= stored_len, "lost direct literals");
+        compress_lits(s, ltree, (const unsigned char *)buf + stored_len - s->direct_lits, s->direct_lits);
     }
 
     zng_emit_end_block(s, ltree, 0);
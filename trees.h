@@ -18,6 +18,12 @@
 #define REPZ_11_138  18
 /* repeat a zero length 11-138 times  (7 bits of repeat count) */
 
+/* Code of the static trees combined with its extra bits, ready to be sent */
+typedef struct sc_data_s {
+    uint32_t bits;  /* code and extra bits, distances add (dist << 5) */
+    uint32_t len;   /* number of bits */
+} sc_data;
+
 static const int extra_lbits[LENGTH_CODES] /* extra bits for each length code */
     = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
 
@@ -21,6 +21,9 @@ extern const unsigned char Z_INTERNAL zng_length_code[STD_MAX_MATCH-STD_MIN_MATC
 extern Z_INTERNAL const int base_length[LENGTH_CODES];
 extern Z_INTERNAL const int base_dist[D_CODES];
 
+extern Z_INTERNAL const sc_data static_lcode[STD_MAX_MATCH-STD_MIN_MATCH+1];
+extern Z_INTERNAL const sc_data static_dcode[DIST_CODE_LEN];
+
 /* Bit buffer and deflate code stderr tracing */
 #ifdef ZLIB_DEBUG
 #  define send_bits_trace(s, value, length) { \
@@ -164,6 +167,38 @@ static inline uint32_t zng_emit_dist(deflate_state *s, const ct_data *ltree, con
     return match_bits_len;
 }
 
+/* ===========================================================================
+ * Emit match distance/length code of the static trees. The codes come with
+ * their extra bits from one lookup each instead of the chain of code, tree,
+ * extra bits and base lookups of zng_emit_dist().
+ */
+static inline uint32_t zng_emit_dist_static(deflate_state *s, uint32_t lc, uint32_t dist) {
+    const sc_data *lcode, *dcode;
+    uint64_t match_bits;
+    uint32_t match_bits_len;
+    uint32_t bi_valid = s->bi_valid;
+    uint64_t bi_buf = s->bi_buf;
+
+    /* lc is the match length - STD_MIN_MATCH */
+    lcode = &static_lcode[lc];
+    send_code_trace(s, zng_length_code[lc]+LITERALS+1);
+
+    dist--; /* dist is now the match distance - 1 */
+    dcode = &static_dcode[dist < 256 ? dist : 256+(dist>>7)];
+    Assert(d_code(dist) < D_CODES, "bad d_code");
+    send_code_trace(s, d_code(dist));
+
+    match_bits = lcode->bits | ((uint64_t)(dcode->bits + (dist << 5)) << lcode->len);
+    match_bits_len = lcode->len + dcode->len;
+
+    send_bits(s, match_bits, match_bits_len, bi_buf, bi_valid);
+
+    s->bi_valid = bi_valid;
+    s->bi_buf = bi_buf;
+
+    return match_bits_len;
+}
+
 /* ===========================================================================
  * Emit end block
  */
@@ -193,6 +228,13 @@ static inline void zng_tr_emit_dist(deflate_state *s, const ct_data *ltree, cons
     cmpr_bits_add(s, zng_emit_dist(s, ltree, dtree, lc, dist));
 }
 
+/* ===========================================================================
+ * Emit match of the static trees and count bits
+ */
+static inline void zng_tr_emit_dist_static(deflate_state *s, uint32_t lc, uint32_t dist) {
+    cmpr_bits_add(s, zng_emit_dist_static(s, lc, dist));
+}
+
 /* ===========================================================================
  * Emit start of block
  */
@@ -129,4 +129,128 @@ Z_INTERNAL const int base_dist[D_CODES] = {
  1024,  1536,  2048,  3072,  4096,  6144,  8192, 12288, 16384, 24576
 };
 
+Z_INTERNAL const sc_data static_lcode[STD_MAX_MATCH-STD_MIN_MATCH+1] = {
+{  64, 7}, {  32, 7}, {  96, 7}, {  16, 7}, {  80, 7}, {  48, 7}, { 112, 7}, {   8, 7},
+{  72, 8}, { 200, 8}, {  40, 8}, { 168, 8}, { 104, 8}, { 232, 8}, {  24, 8}, { 152, 8},
+{  88, 9}, { 216, 9}, { 344, 9}, { 472, 9}, {  56, 9}, { 184, 9}, { 312, 9}, { 440, 9},
+{ 120, 9}, { 248, 9}, { 376, 9}, { 504, 9}, {   4, 9}, { 132, 9}, { 260, 9}, { 388, 9},
+{  68,10}, { 196,10}, { 324,10}, { 452,10}, { 580,10}, { 708,10}, { 836,10}, { 964,10},
+{  36,10}, { 164,10}, { 292,10}, { 420,10}, { 548,10}, { 676,10}, { 804,10}, { 932,10},
+{ 100,10}, { 228,10}, { 356,10}, { 484,10}, { 612,10}, { 740,10}, { 868,10}, { 996,10},
+{  20,10}, { 148,10}, { 276,10}, { 404,10}, { 532,10}, { 660,10}, { 788,10}, { 916,10},
+{  84,11}, { 212,11}, { 340,11}, { 468,11}, { 596,11}, { 724,11}, { 852,11}, { 980,11},
+{1108,11}, {1236,11}, {1364,11}, {1492,11}, {1620,11}, {1748,11}, {1876,11}, {2004,11},
+{  52,11}, { 180,11}, { 308,11}, { 436,11}, { 564,11}, { 692,11}, { 820,11}, { 948,11},
+{1076,11}, {1204,11}, {1332,11}, {1460,11}, {1588,11}, {1716,11}, {1844,11}, {1972,11},
+{ 116,11}, { 244,11}, { 372,11}, { 500,11}, { 628,11}, { 756,11}, { 884,11}, {1012,11},
+{1140,11}, {1268,11}, {1396,11}, {1524,11}, {1652,11}, {1780,11}, {1908,11}, {2036,11},
+{   3,12}, { 259,12}, { 515,12}, { 771,12}, {1027,12}, {1283,12}, {1539,12}, {1795,12},
+{2051,12}, {2307,12}, {2563,12}, {2819,12}, {3075,12}, {3331,12}, {3587,12}, {3843,12},
+{ 131,13}, { 387,13}, { 643,13}, { 899,13}, {1155,13}, {1411,13}, {1667,13}, {1923,13},
+{2179,13}, {2435,13}, {2691,13}, {2947,13}, {3203,13}, {3459,13}, {3715,13}, {3971,13},
+{4227,13}, {4483,13}, {4739,13}, {4995,13}, {5251,13}, {5507,13}, {5763,13}, {6019,13},
+{6275,13}, {6531,13}, {6787,13}, {7043,13}, {7299,13}, {7555,13}, {7811,13}, {8067,13},
+{  67,13}, { 323,13}, { 579,13}, { 835,13}, {1091,13}, {1347,13}, {1603,13}, {1859,13},
+{2115,13}, {2371,13}, {2627,13}, {2883,13}, {3139,13}, {3395,13}, {3651,13}, {3907,13},
+{4163,13}, {4419,13}, {4675,13}, {4931,13}, {5187,13}, {5443,13}, {5699,13}, {5955,13},
+{6211,13}, {6467,13}, {6723,13}, {6979,13}, {7235,13}, {7491,13}, {7747,13}, {8003,13},
+{ 195,13}, { 451,13}, { 707,13}, { 963,13}, {1219,13}, {1475,13}, {1731,13}, {1987,13},
+{2243,13}, {2499,13}, {2755,13}, {3011,13}, {3267,13}, {3523,13}, {3779,13}, {4035,13},
+{4291,13}, {4547,13}, {4803,13}, {5059,13}, {5315,13}, {5571,13}, {5827,13}, {6083,13},
+{6339,13}, {6595,13}, {6851,13}, {7107,13}, {7363,13}, {7619,13}, {7875,13}, {8131,13},
+{  35,13}, { 291,13}, { 547,13}, { 803,13}, {1059,13}, {1315,13}, {1571,13}, {1827,13},
+{2083,13}, {2339,13}, {2595,13}, {2851,13}, {3107,13}, {3363,13}, {3619,13}, {3875,13},
+{4131,13}, {4387,13}, {4643,13}, {4899,13}, {5155,13}, {5411,13}, {5667,13}, {5923,13},
+{6179,13}, {6435,13}, {6691,13}, {6947,13}, {7203,13}, {7459,13}, {7715,13}, { 163, 8}
+};
+
+Z_INTERNAL const sc_data static_dcode[DIST_CODE_LEN] = {
+{0x00000000, 5}, {0xfffffff0, 5}, {0xffffffc8, 5}, {0xffffffb8, 5}, {0xffffff84, 6}, {0xffffff84, 6},
+{0xffffff54, 6}, {0xffffff54, 6}, {0xffffff0c, 7}, {0xffffff0c, 7}, {0xffffff0c, 7}, {0xffffff0c, 7},
+{0xfffffe9c, 7}, {0xfffffe9c, 7}, {0xfffffe9c, 7}, {0xfffffe9c, 7}, {0xfffffe02, 8}, {0xfffffe02, 8},
+{0xfffffe02, 8}, {0xfffffe02, 8}, {0xfffffe02, 8}, {0xfffffe02, 8}, {0xfffffe02, 8}, {0xfffffe02, 8},
+{0xfffffd12, 8}, {0xfffffd12, 8}, {0xfffffd12, 8}, {0xfffffd12, 8}, {0xfffffd12, 8}, {0xfffffd12, 8},
+{0xfffffd12, 8}, {0xfffffd12, 8}, {0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9},
+{0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9},
+{0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9}, {0xfffffc0a, 9},
+{0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9},
+{0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9},
+{0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffffa1a, 9}, {0xfffff806,10}, {0xfffff806,10},
+{0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10},
+{0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10},
+{0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10},
+{0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10},
+{0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10}, {0xfffff806,10},
+{0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10},
+{0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10},
+{0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10},
+{0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10},
+{0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10}, {0xfffff416,10},
+{0xfffff416,10}, {0xfffff416,10}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11}, {0xfffff00e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11},
+{0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0xffffe81e,11}, {0x00000000, 5}, {0x00000000, 5},
+{0xffffe001,12}, {0xffffd011,12}, {0xffffc009,13}, {0xffffc009,13}, {0xffffa019,13}, {0xffffa019,13},
+{0xffff8005,14}, {0xffff8005,14}, {0xffff8005,14}, {0xffff8005,14}, {0xffff4015,14}, {0xffff4015,14},
+{0xffff4015,14}, {0xffff4015,14}, {0xffff000d,15}, {0xffff000d,15}, {0xffff000d,15}, {0xffff000d,15},
+{0xffff000d,15}, {0xffff000d,15}, {0xffff000d,15}, {0xffff000d,15}, {0xfffe801d,15}, {0xfffe801d,15},
+{0xfffe801d,15}, {0xfffe801d,15}, {0xfffe801d,15}, {0xfffe801d,15}, {0xfffe801d,15}, {0xfffe801d,15},
+{0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16},
+{0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16},
+{0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16}, {0xfffe0003,16}, {0xfffd0013,16}, {0xfffd0013,16},
+{0xfffd0013,16}, {0xfffd0013,16}, {0xfffd0013,16}, {0xfffd0013,16}, {0xfffd0013,16}, {0xfffd0013,16},
+{0xfffd0013,16}, {0xfffd0013,16}, {0xfffd0013,16}, {0xfffd0013,16}, {0xfffd0013,16}, {0xfffd0013,16},
+{0xfffd0013,16}, {0xfffd0013,16}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17},
+{0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17},
+{0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17},
+{0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17},
+{0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17},
+{0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffc000b,17}, {0xfffa001b,17}, {0xfffa001b,17},
+{0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17},
+{0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17},
+{0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17},
+{0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17},
+{0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17}, {0xfffa001b,17},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18},
+{0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff80007,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18}, {0xfff40017,18},
+{0xfff40017,18}, {0xfff40017,18}
+};
+
 #endif /* TREES_TBL_H_ */
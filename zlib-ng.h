@@ -195,6 +195,7 @@ typedef zng_gz_header *zng_gz_headerp;
 #define Z_HUFFMAN_ONLY        2
 #define Z_RLE                 3
 #define Z_FIXED               4
+#define Z_ADAPTIVE            5
 #define Z_DEFAULT_STRATEGY    0
 /* compression strategy; see deflateInit2() below for details */
 
@@ -585,17 +586,21 @@ int zng_deflateInit2(zng_stream *strm, int  level, int  method, int  windowBits,
      The strategy parameter is used to tune the compression algorithm.  Use the
    value Z_DEFAULT_STRATEGY for normal data, Z_FILTERED for data produced by a
    filter (or predictor), Z_HUFFMAN_ONLY to force Huffman encoding only (no
-   string match), or Z_RLE to limit match distances to one (run-length
-   encoding).  Filtered data consists mostly of small values with a somewhat
-   random distribution.  In this case, the compression algorithm is tuned to
-   compress them better.  The effect of Z_FILTERED is to force more Huffman
-   coding and less string matching; it is somewhat intermediate between
-   Z_DEFAULT_STRATEGY and Z_HUFFMAN_ONLY.  Z_RLE is designed to be almost as
-   fast as Z_HUFFMAN_ONLY, but give better compression for PNG image data.  The
-   strategy parameter only affects the compression ratio but not the
+   string match), or Z_RLE to limit match distances to one through eight
+   (run-length encoding of bytes and of short repeated patterns).  Filtered
+   data consists mostly of small values with a somewhat random distribution.
+   In this case, the compression algorithm is tuned to compress them better.
+   The effect of Z_FILTERED is to force more Huffman coding and less string
+   matching; it is somewhat intermediate between Z_DEFAULT_STRATEGY and
+   Z_HUFFMAN_ONLY.  Z_RLE is designed to be almost as fast as Z_HUFFMAN_ONLY,
+   but give better compression for PNG image data and for arrays of repeated
+   16, 32 or 64-bit values.  The strategy parameter only affects the compression ratio but not the
    correctness of the compressed output even if it is not set appropriately.
    Z_FIXED prevents the use of dynamic Huffman codes, allowing for a simpler
-   decoder for special applications.
+   decoder for special applications.  Z_ADAPTIVE chooses for each block between
+   the string matching of the compression level, Z_RLE and Z_HUFFMAN_ONLY (or
+   stored), based on what the previous block contained, which gains speed on
+   input mixing text, runs and already compressed data.
 
      deflateInit2 returns Z_OK if success, Z_MEM_ERROR if there was not enough
    memory, Z_STREAM_ERROR if any parameter is invalid (such as an invalid
@@ -1839,6 +1844,12 @@ typedef enum {
        reproducibility is strictly required. Reproducibility is guaranteed only when using an identical zlib-ng build.
        Default is 0.
     */
+    Z_DEFLATE_HASH_LENGTH = 3,
+    /*
+         Number of bytes hashed to find the earlier occurrences of a string, represented as an int: 4, 5, 6 or 8.
+       Longer keys leave fewer false candidates to compare on binary and structured data, at the cost of the matches
+       shorter than the key, which text tends to favour. Level 9 always hashes 3 bytes. Default is 4.
+    */
 } zng_deflate_param;
 
 typedef struct {
@@ -1877,6 +1888,235 @@ int32_t zng_deflateGetParams(zng_stream *strm, zng_deflate_param_value *params,
    entire value of the corresponding parameter.
 */
 
+                        /* caller-supplied parse */
+
+typedef struct {
+    uint32_t lit_len;    /* number of literals before the match */
+    uint32_t match_len;  /* length of the match, 0 for none or 3 to 258 */
+    uint32_t dist;       /* distance of the match back from its first byte */
+} zng_deflate_sequence;
+
+Z_EXTERN Z_EXPORT
+int32_t zng_deflateSequences(zng_stream *strm, zng_deflate_sequence *seqs, size_t *count, int32_t flush);
+/*
+     Compresses the input like deflate() with the given flush, but sends it as the literals and matches of the
+   count sequences in seqs instead of searching for matches of its own. Each sequence covers the next
+   lit_len + match_len bytes of input: lit_len literals, then match_len bytes that repeat those dist bytes
+   before them. Every match is checked against the data. Its distance may not go further back than the start of
+   the stream, the preset dictionary or the last Z_FULL_FLUSH, nor than the window size less 262 bytes, which is
+   32506 for the default windowBits of 15. The level and strategy only choose how blocks are sent: level 0
+   stores them, Z_FIXED uses the fixed codes, and otherwise the smallest of dynamic, fixed or stored is used.
+
+     On return *count is the number of sequences sent in full. If the output buffer filled up, or with
+   Z_NO_FLUSH the input ran out, before all of them were sent, lit_len of the next one is decreased by the
+   literals already sent and deflateSequences() is called again with the sequences left, as deflate() is with
+   the input left. Input past the last sequence is kept for the sequences of the next call, or sent as literals
+   by a call with a flush other than Z_NO_FLUSH. A stream is finished by calling deflateSequences() with
+   Z_FINISH until it returns Z_STREAM_END, *count may be 0 by then.
+
+     deflateSequences() returns the values that deflate() would, or Z_DATA_ERROR if a sequence has an invalid
+   length or distance, does not match the data, or runs past the end of the input with a flush other than
+   Z_NO_FLUSH. strm->msg then tells which, and that sequence is left unsent. A stream switches from deflate() to
+   deflateSequences() or back, or calls deflateParams(), only after a call with a flush other than Z_NO_FLUSH
+   has completed. Otherwise Z_STREAM_ERROR is returned.
+*/
+
+Z_EXTERN Z_EXPORT
+int32_t zng_transcode(uint8_t *dest, size_t *destLen, const uint8_t *source, size_t *sourceLen,
+                      int32_t level, int32_t windowBits);
+/*
+     Recompresses the deflate stream in source at the given level into dest, without going through its
+   uncompressed data as a whole. windowBits is taken as by inflateInit2() and tells the wrapper of the source,
+   which dest gets too, along with the same window size and gzip header. Unless level is above the one the zlib
+   or gzip header of the source tells, or 6 for a raw source, the literals and matches of the source are handed to
+   deflateSequences(), which chooses the blocks and their codes again. That keeps the parse of the source, which
+   is several times faster than compressing the data again and much smaller than what a lower level finds.
+   Matches further back than deflate can send, the window size less 262 bytes, are sent as literals. For a higher
+   level, the source is decompressed and compressed again as inflate() and deflate() would.
+
+     On entry *destLen is the size of dest and *sourceLen the length of the source. On return *destLen is the
+   size of the recompressed stream and *sourceLen the number of source bytes consumed. The check value in the
+   trailer of a zlib or gzip source is verified. A zlib source that needs a preset dictionary is not supported.
+
+     transcode returns Z_OK if success, Z_MEM_ERROR if there was not enough memory, Z_BUF_ERROR if there was not
+   enough room in the output buffer, Z_STREAM_ERROR if the level or windowBits is not valid, or Z_DATA_ERROR if
+   the source is corrupted or incomplete.
+*/
+
+                        /* shared dictionaries */
+
+typedef struct zng_deflate_dictionary_s zng_deflate_dictionary;
+
+Z_EXTERN Z_EXPORT
+zng_deflate_dictionary *zng_deflateDictionaryCreate(zng_stream *strm, const uint8_t *dictionary, uint32_t dictLength);
+/*
+     Sets the dictionary of strm as deflateSetDictionary() does, and returns a copy of the window and hash
+   tables it leaves, which deflateUseDictionary() gives to other streams without hashing the dictionary again,
+   along with as much of the dictionary as a window of 32K takes. strm must not have been given any input or
+   dictionary yet. It should be set up with the level, window size, strategy and Z_DEFLATE_HASH_LENGTH of the
+   streams that will use the dictionary, which are what the hash tables depend on. The memory comes from
+   strm->zalloc, and is released with zng_deflateDictionaryFree().
+
+     deflateDictionaryCreate() returns NULL if strm already has input or a dictionary, if deflateSetDictionary()
+   fails, or if there was not enough memory for the copy, in which case strm has the dictionary set nonetheless.
+*/
+
+Z_EXTERN Z_EXPORT
+int32_t zng_deflateUseDictionary(zng_stream *strm, const zng_deflate_dictionary *dict);
+/*
+     Same as deflateSetDictionary() with the dictionary that dict was created from, and the same rules for when
+   it may be called. If strm has no input or dictionary yet and hashes like the stream dict was created with,
+   its window and hash tables are copied from dict, otherwise the dictionary is hashed as deflateSetDictionary()
+   would, up to what the window of strm takes even if it is larger than that of the stream dict was created
+   with. The output is the same either way. dict is not changed, and may be used by any number of streams at
+   the same time, from any threads, until it is freed.
+
+     deflateUseDictionary returns Z_OK if success, Z_MEM_ERROR if strm was hibernated or forked and there was
+   not enough memory to take back its buffers or its own hash table (see deflateHibernate() and deflateFork()),
+   or Z_STREAM_ERROR if dict is NULL or the stream state is inconsistent.
+*/
+
+Z_EXTERN Z_EXPORT
+void zng_deflateDictionaryFree(zng_deflate_dictionary *dict);
+/*
+     Frees a dictionary created by deflateDictionaryCreate(), once no deflateUseDictionary() call with it runs
+   anymore. The streams it was given to do not refer to it.
+*/
+
+Z_EXTERN Z_EXPORT
+int32_t zng_inflateAttachDictionary(zng_stream *strm, const uint8_t *dictionary, uint32_t dictLength);
+/*
+     Same as inflateSetDictionary(), with the same rules for when it may be called, but when strm has no
+   history yet the dictionary is not copied: inflate() reads matches from it where they are, and copies the
+   part it still needs to the window only once the window has to change, that is when a call of inflate()
+   that writes output returns without having written the whole window again, unless it finished the stream
+   with Z_FINISH. A stream inflated by a single inflate(strm, Z_FINISH) never copies it. The same dictionary may be
+   attached to any number of streams at the same time, which only read it, and must not be changed or freed
+   until each stream is reset or ended.
+
+     inflateAttachDictionary returns the same values as inflateSetDictionary().
+*/
+
+                        /* stream forks */
+
+Z_EXTERN Z_EXPORT
+int32_t zng_deflateFork(zng_stream *dest, zng_stream *source);
+/*
+     Same as deflateCopy(), for trying several continuations of a stream and keeping one, such as two levels
+   or a flush against no flush. Only the parts of the window, hash chains and pending output in use are
+   copied, and the table of hash chain heads is shared by dest and source until one of them changes it, at
+   its next deflate(), deflateParams(), deflateReset() or dictionary call, which copies it for that stream
+   and may therefore return Z_MEM_ERROR. The output of dest is the same as that of a deflateCopy() of source.
+
+     Unlike deflateCopy(), deflateFork reads dest->state, so dest must either have its state set to NULL,
+   such as a zeroed stream or one that deflateEnd() ended, or be a deflate stream that was not ended. An
+   uninitialized dest is not detected and may crash. When dest is a deflate stream its memory is reused if
+   it was set up with the same windowBits, memLevel and memory functions as source, which saves allocating
+   it when the same streams are forked again and again, and it is ended first otherwise.
+
+     deflateFork returns the same values as deflateCopy(), and Z_STREAM_ERROR if dest is source.
+*/
+
+                        /* stream hibernation */
+
+Z_EXTERN Z_EXPORT
+int32_t zng_deflateHibernate(zng_stream *strm);
+/*
+     Frees the memory of strm that it does not need to keep its history, for a stream that stays idle for a
+   while, such as one of many connections. It can be called once deflate() has written out all of its output
+   at the end of a block, for instance after deflate() with Z_SYNC_FLUSH or Z_FULL_FLUSH returned with
+   avail_out not zero. The buffer for pending output and for the symbols of a block is freed, and so are the
+   hash chains when hashing the window again gives them back as they were, which is checked first and is
+   commonly the case when the level was not changed since deflate() last wrote to the window. The window
+   itself is kept.
+
+     The memory is allocated again by the next call that needs it, deflate() or any other except deflateEnd(),
+   which then returns Z_MEM_ERROR if there is not enough of it. The compressed data is the same as if strm
+   had never hibernated. Checking and rebuilding the hash chains takes about as long as compressing some tens
+   of kilobytes, so that hibernating is worth it for a stream that stays idle, rather than after every message.
+
+     deflateHibernate returns Z_OK if success, Z_BUF_ERROR if output is still pending or a block is not
+   finished, or Z_STREAM_ERROR if the stream state was inconsistent. Calling it for a stream that is
+   hibernating already does nothing.
+*/
+
+Z_EXTERN Z_EXPORT
+int32_t zng_inflateHibernate(zng_stream *strm);
+/*
+     Same as deflateHibernate() for inflate streams, to be called between blocks, for instance once inflate()
+   has consumed all of the input that deflate() wrote up to a Z_SYNC_FLUSH. The window is freed, and the
+   history it holds is kept in memory of its size, which inflate() reads in place until the window has to
+   change, that is at the next inflate() call that writes output. The state of strm, about 7K bytes, is kept.
+
+     inflateHibernate returns Z_OK if success, Z_BUF_ERROR if strm is inside a block, Z_MEM_ERROR if there was
+   not enough memory for the history, in which case strm is left as it was, or Z_STREAM_ERROR if the stream
+   state was inconsistent.
+*/
+
+                        /* parallel checksum functions */
+
+typedef void (*zng_task_func) (void *task_arg, size_t index);
+typedef int32_t (*zng_run_func) (void *opaque, zng_task_func task, void *task_arg, size_t count);
+
+typedef struct zng_executor_s {
+    zng_run_func run;         /* runs task(task_arg, i) for every i in [0, count) */
+    void    *opaque;          /* private data object passed to run */
+    size_t   max_tasks;       /* maximum number of tasks to split one call into */
+    size_t   min_task_size;   /* minimum number of bytes per task, 0 for default */
+} zng_executor;
+
+/*
+     The executor lets the application supply the threads used by the parallel
+   checksum functions, so that the library never creates threads of its own.
+   run() must call task(task_arg, i) exactly once for every i in [0, count),
+   in any order and on any threads, and must not return until all of those
+   calls have returned. It returns Z_OK on success. If it returns anything
+   else, it must not have called task at all, and the checksum is then computed
+   on the calling thread instead.
+*/
+
+Z_EXTERN Z_EXPORT
+uint32_t zng_crc32_parallel(uint32_t crc, const uint8_t *buf, size_t len, const zng_executor *executor);
+/*
+     Same as crc32_z(), but splits buf into up to executor->max_tasks slices of
+   at least executor->min_task_size bytes each, computes their CRC-32 values
+   concurrently through executor->run, and combines them with the
+   crc32_combine_op() operators. If executor is Z_NULL, or len is too short to
+   be worth splitting, the CRC-32 is computed on the calling thread.
+*/
+
+Z_EXTERN Z_EXPORT
+uint32_t zng_adler32_parallel(uint32_t adler, const uint8_t *buf, size_t len, const zng_executor *executor);
+/*
+     Same as adler32_z(), but computes the Adler-32 checksum of slices of buf
+   concurrently through executor and combines them with adler32_combine(), as
+   described for crc32_parallel().
+*/
+
+                        /* multi-buffer checksum functions */
+
+typedef struct zng_checksum_buf_s {
+    const uint8_t *buf;       /* data to checksum, or Z_NULL for the initial value */
+    size_t   len;             /* number of bytes at buf */
+    uint32_t seed;            /* checksum to continue from */
+    uint32_t result;          /* set to the checksum of buf continued from seed */
+} zng_checksum_buf;
+
+Z_EXTERN Z_EXPORT
+void zng_crc32_multi(zng_checksum_buf *bufs, size_t count);
+/*
+     Computes crc32_z(bufs[i].seed, bufs[i].buf, bufs[i].len) into bufs[i].result
+   for every i in [0, count). The buffers are independent of each other and
+   are processed several at a time in interleaved lanes, which is considerably
+   faster than separate crc32() calls for large numbers of short buffers.
+*/
+
+Z_EXTERN Z_EXPORT
+void zng_adler32_multi(zng_checksum_buf *bufs, size_t count);
+/*
+     Same as crc32_multi(), but computes Adler-32 checksums as adler32_z() does.
+*/
+
 /* undocumented functions */
 Z_EXTERN Z_EXPORT const char *     zng_zError           (int32_t);
 Z_EXTERN Z_EXPORT int32_t          zng_inflateSyncPoint (zng_stream *);
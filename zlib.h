@@ -594,14 +594,15 @@ Z_EXTERN int Z_EXPORT deflateInit2 (z_stream *strm,
      The strategy parameter is used to tune the compression algorithm.  Use the
    value Z_DEFAULT_STRATEGY for normal data, Z_FILTERED for data produced by a
    filter (or predictor), Z_HUFFMAN_ONLY to force Huffman encoding only (no
-   string match), or Z_RLE to limit match distances to one (run-length
-   encoding).  Filtered data consists mostly of small values with a somewhat
-   random distribution.  In this case, the compression algorithm is tuned to
-   compress them better.  The effect of Z_FILTERED is to force more Huffman
-   coding and less string matching; it is somewhat intermediate between
-   Z_DEFAULT_STRATEGY and Z_HUFFMAN_ONLY.  Z_RLE is designed to be almost as
-   fast as Z_HUFFMAN_ONLY, but give better compression for PNG image data.  The
-   strategy parameter only affects the compression ratio but not the
+   string match), or Z_RLE to limit match distances to one through eight
+   (run-length encoding of bytes and of short repeated patterns).  Filtered
+   data consists mostly of small values with a somewhat random distribution.
+   In this case, the compression algorithm is tuned to compress them better.
+   The effect of Z_FILTERED is to force more Huffman coding and less string
+   matching; it is somewhat intermediate between Z_DEFAULT_STRATEGY and
+   Z_HUFFMAN_ONLY.  Z_RLE is designed to be almost as fast as Z_HUFFMAN_ONLY,
+   but give better compression for PNG image data and for arrays of repeated
+   16, 32 or 64-bit values.  The strategy parameter only affects the compression ratio but not the
    correctness of the compressed output even if it is not set appropriately.
    Z_FIXED prevents the use of dynamic Huffman codes, allowing for a simpler
    decoder for special applications.